@@ -8,14 +8,26 @@ CONFIG += c++17
 # In order to do so, uncomment the following line.
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
+include(gamecore.pri)
+
 SOURCES += \
+    boardwidget.cpp \
     main.cpp \
     mainwindow.cpp \
-    model.cpp
+    padanimator.cpp \
+    padinput.cpp \
+    placementengine.cpp \
+    shadowcache.cpp \
+    simonpad.cpp
 
 HEADERS += \
+    boardwidget.h \
     mainwindow.h \
-    model.h
+    padanimator.h \
+    padinput.h \
+    placementengine.h \
+    shadowcache.h \
+    simonpad.h
 
 FORMS += \
     mainwindow.ui
@@ -0,0 +1,14 @@
+# QtTest micro-benchmarks for the Model hot paths.
+# Run with e.g. "tst_modelbench -iterations 1000" or "tst_modelbench -csv".
+
+QT = core testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_modelbench
+
+include(../../gamecore.pri)
+
+SOURCES += \
+    tst_modelbench.cpp
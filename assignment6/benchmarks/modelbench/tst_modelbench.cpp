@@ -0,0 +1,390 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * tst_modelbench.cpp
+ *
+ * QBENCHMARK micro-benchmarks for the Model hot paths: addRound,
+ * playSequence, checkIsTrueButton, checkPresses and startGame. Every benchmark runs at
+ * 10, 1k, 100k and 1M rounds, once with no receivers and once with a
+ * receiver connected to every Model signal the way MainWindow is.
+ *
+ * corePress and corePressBatch run the same presses straight on SimonCore,
+ * once with the Model's own core type and once with two colors and packed
+ * storage fixed at compile time, to show what the QObject adapter costs.
+ *
+ * Round transitions of the Model are posted to the event loop; the
+ * benchmarks deliver them and report the playback as finished the way
+ * MainWindow does, and that cost is part of the press benchmarks.
+ *
+ * Besides the QtTest result, each row prints its ns/op and allocations/op
+ * measured over a fixed number of operations. Allocations are counted by
+ * interposing malloc on glibc (which also catches Qt containers) and by
+ * replacing the global operator new elsewhere.
+ */
+
+#include <QtTest>
+#include <QElapsedTimer>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include "counterrng.h"
+#include "model.h"
+#include "simoncore.h"
+
+namespace {
+
+std::atomic<qint64> g_allocations{0}; ///< Number of heap allocations so far.
+
+}
+
+#if defined(__GLIBC__)
+
+extern "C" {
+void *__libc_malloc(std::size_t size);
+void *__libc_calloc(std::size_t count, std::size_t size);
+void *__libc_realloc(void *ptr, std::size_t size);
+
+void *malloc(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void *calloc(std::size_t count, std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+}
+
+#else
+
+void *operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+#endif
+
+namespace {
+
+/**
+ * @brief Stands in for the view: listens to every Model signal and, like
+ *        the playback scheduler, keeps the last published round.
+ */
+class Receivers : public QObject {
+public:
+    explicit Receivers(Model *model) {
+        connect(model, &Model::lose, this, [this]() { m_events++; });
+        connect(model, &Model::gameRestarted, this, [this]() { m_events++; });
+        connect(model, &Model::phaseChanged, this, [this](Model::Phase) { m_events++; });
+        connect(model, &Model::sequenceReady, this, [this](const PlaybackRound &round) {
+            m_lastRound = round;
+            m_events++;
+        });
+        connect(model, &Model::roundStateChanged, this, [this](const RoundState &state) {
+            m_version = state.version;
+            m_events++;
+        });
+    }
+
+private:
+    PlaybackRound m_lastRound; ///< The round a view would be playing.
+    quint64 m_version = 0;     ///< Version of the last round state.
+    qint64 m_events = 0;       ///< Number of signals received.
+};
+
+// Delivers a posted round transition and reports the playback as done, like the view does.
+void settle(Model &model) {
+    QCoreApplication::sendPostedEvents(&model, QEvent::MetaCall);
+    model.playbackFinished();
+}
+
+// A core has no transitions to wait for.
+template <typename Core>
+void settle(Core &) {}
+
+// Brings a fresh game to the given round, awaiting input, without any receivers connected.
+void advanceTo(Model &model, int rounds) {
+    model.setSeed(42);
+    model.startGame();
+    settle(model);
+    for (int r = 1; r < rounds; r++)
+        model.addRound();
+    model.playbackFinished();
+}
+
+// Presses the correct button for the next move; a completed round is settled.
+void pressCorrect(Model &model) {
+    model.checkIsTrueButton(model.moveAt(model.userIndex()) == 1);
+    if (model.phase() != Model::Phase::AwaitInput)
+        settle(model);
+}
+
+// Presses the correct pad for the next move straight on a core.
+template <typename Core>
+void pressCorrect(Core &core) {
+    core.press(core.moveAt(core.userIndex()));
+}
+
+// Brings a fresh core to the given round.
+template <typename Core>
+void advanceTo(Core &core, int rounds) {
+    core.start(42);
+    for (int r = 1; r < rounds; r++)
+        core.advanceRound();
+}
+
+// Builds the next burst of correct presses, carrying on into the following rounds.
+MoveSequence correctBurst(quint64 seed, int colors, int index, int length, int count) {
+    MoveSequence burst(MoveSequence::bitsForColors(colors));
+    for (int i = 0; i < count; i++) {
+        burst.append(CounterRng::moveAt(seed, static_cast<quint64>(index), colors));
+        if (++index == length) {
+            index = 0;
+            length++;
+        }
+    }
+    return burst;
+}
+
+MoveSequence correctBurst(const Model &model, int count) {
+    return correctBurst(model.seed(), model.colorCount(), model.userIndex(), model.sequenceLength(), count);
+}
+
+template <typename Core>
+MoveSequence correctBurst(const Core &core, int count) {
+    return correctBurst(core.seed(), core.colorCount(), core.userIndex(), core.round(), count);
+}
+
+// Runs an operation a fixed number of times and prints its ns/op and allocations/op.
+template <typename Op>
+void reportPerOp(int ops, Op op) {
+    qint64 allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < ops; i++)
+        op();
+    qint64 ns = timer.nsecsElapsed();
+    qint64 allocations = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+    qInfo("%s: %.1f ns/op, %.3f allocations/op", QTest::currentDataTag(),
+          double(ns) / ops, double(allocations) / ops);
+}
+
+// Validates fresh bursts of 64 correct presses and reports the time per burst;
+// building the bursts is not timed.
+template <typename Game, typename Check>
+void reportBursts(Game &game, Check check) {
+    const int samples = 1000;
+    qint64 totalNs = 0;
+    qint64 totalAllocations = 0;
+    for (int i = 0; i < samples; i++) {
+        MoveSequence burst = correctBurst(game, 64);
+
+        qint64 allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+        QElapsedTimer timer;
+        timer.start();
+        PressBatchResult result = check(burst.view());
+        totalNs += timer.nsecsElapsed();
+        totalAllocations += g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+        QVERIFY(!result.lost());
+        QCOMPARE(result.accepted, qsizetype(64));
+        // Move on to the next round, if the burst completed one, outside the timing.
+        settle(game);
+    }
+
+    qInfo("%s: %.1f ns/burst, %.3f allocations/burst", QTest::currentDataTag(),
+          double(totalNs) / samples, double(totalAllocations) / samples);
+    QTest::setBenchmarkResult(qreal(totalNs) / samples, QTest::WalltimeNanoseconds);
+}
+
+// Single correct presses straight on a core at the given round.
+template <typename Core>
+void benchCorePress(int rounds) {
+    Core core;
+    advanceTo(core, rounds);
+    reportPerOp(1000, [&core]() { pressCorrect(core); });
+    QBENCHMARK {
+        pressCorrect(core);
+    }
+}
+
+// Bursts of correct presses straight on a core at the given round.
+template <typename Core>
+void benchCorePressBatch(int rounds) {
+    Core core;
+    advanceTo(core, rounds);
+    reportBursts(core, [&core](MoveSequenceView presses) { return core.pressBatch(presses); });
+}
+
+/// The fastest core: two colors and packed storage fixed at compile time.
+using StaticCore = SimonCore<2, PackedStorage>;
+
+}
+
+class ModelBench : public QObject {
+    Q_OBJECT
+
+private slots:
+    void addRound_data() { addRows(); }
+    void addRound();
+    void playSequence_data() { addRows(); }
+    void playSequence();
+    void checkIsTrueButton_data() { addRows(); }
+    void checkIsTrueButton();
+    void checkPresses_data() { addRows(); }
+    void checkPresses();
+    void startGame_data() { addRows(); }
+    void startGame();
+    void corePress_data() { addCoreRows(); }
+    void corePress();
+    void corePressBatch_data() { addCoreRows(); }
+    void corePressBatch();
+
+private:
+    static void addRows();
+    static void addCoreRows();
+};
+
+void ModelBench::addRows() {
+    QTest::addColumn<int>("rounds");
+    QTest::addColumn<bool>("receivers");
+    for (int rounds : {10, 1000, 100000, 1000000}) {
+        QTest::addRow("%d rounds, no receivers", rounds) << rounds << false;
+        QTest::addRow("%d rounds, receivers", rounds) << rounds << true;
+    }
+}
+
+void ModelBench::addCoreRows() {
+    QTest::addColumn<int>("rounds");
+    QTest::addColumn<bool>("staticCore");
+    for (int rounds : {10, 1000, 100000, 1000000}) {
+        QTest::addRow("%d rounds, Model::Core", rounds) << rounds << false;
+        QTest::addRow("%d rounds, SimonCore<2, PackedStorage>", rounds) << rounds << true;
+    }
+}
+
+void ModelBench::addRound() {
+    QFETCH(int, rounds);
+    QFETCH(bool, receivers);
+
+    Model model;
+    advanceTo(model, rounds);
+    std::unique_ptr<Receivers> view(receivers ? new Receivers(&model) : nullptr);
+
+    reportPerOp(1000, [&model]() { model.addRound(); });
+    QBENCHMARK {
+        model.addRound();
+    }
+}
+
+void ModelBench::playSequence() {
+    QFETCH(int, rounds);
+    QFETCH(bool, receivers);
+
+    Model model;
+    advanceTo(model, rounds);
+    std::unique_ptr<Receivers> view(receivers ? new Receivers(&model) : nullptr);
+
+    reportPerOp(1000, [&model]() { model.playSequence(); });
+    QBENCHMARK {
+        model.playSequence();
+    }
+}
+
+void ModelBench::checkIsTrueButton() {
+    QFETCH(int, rounds);
+    QFETCH(bool, receivers);
+
+    Model model;
+    advanceTo(model, rounds);
+    std::unique_ptr<Receivers> view(receivers ? new Receivers(&model) : nullptr);
+
+    // Correct presses walk the sequence and start a new round at its end.
+    reportPerOp(1000, [&model]() { pressCorrect(model); });
+    QBENCHMARK {
+        pressCorrect(model);
+    }
+}
+
+void ModelBench::checkPresses() {
+    QFETCH(int, rounds);
+    QFETCH(bool, receivers);
+
+    Model model;
+    advanceTo(model, rounds);
+    std::unique_ptr<Receivers> view(receivers ? new Receivers(&model) : nullptr);
+
+    reportBursts(model, [&model](MoveSequenceView presses) { return model.checkPresses(presses); });
+}
+
+void ModelBench::startGame() {
+    QFETCH(int, rounds);
+    QFETCH(bool, receivers);
+
+    // startGame() throws the whole sequence away, so every sample needs a
+    // fresh game at the requested round; only the call itself is timed.
+    const int samples = qBound(5, 1000000 / rounds, 1000);
+    qint64 totalNs = 0;
+    qint64 totalAllocations = 0;
+    Model model;
+    for (int i = 0; i < samples; i++) {
+        advanceTo(model, rounds);
+        std::unique_ptr<Receivers> view(receivers ? new Receivers(&model) : nullptr);
+
+        qint64 allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+        QElapsedTimer timer;
+        timer.start();
+        model.startGame();
+        totalNs += timer.nsecsElapsed();
+        totalAllocations += g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+    }
+
+    qInfo("%s: %.1f ns/op, %.3f allocations/op", QTest::currentDataTag(),
+          double(totalNs) / samples, double(totalAllocations) / samples);
+    QTest::setBenchmarkResult(qreal(totalNs) / samples, QTest::WalltimeNanoseconds);
+}
+
+void ModelBench::corePress() {
+    QFETCH(int, rounds);
+    QFETCH(bool, staticCore);
+
+    // The same correct presses as checkIsTrueButton, without the adapter or its signals.
+    if (staticCore)
+        benchCorePress<StaticCore>(rounds);
+    else
+        benchCorePress<Model::Core>(rounds);
+}
+
+void ModelBench::corePressBatch() {
+    QFETCH(int, rounds);
+    QFETCH(bool, staticCore);
+
+    // The same bursts as checkPresses, without the adapter or its signals.
+    if (staticCore)
+        benchCorePressBatch<StaticCore>(rounds);
+    else
+        benchCorePressBatch<Model::Core>(rounds);
+}
+
+QTEST_GUILESS_MAIN(ModelBench)
+
+#include "tst_modelbench.moc"
@@ -0,0 +1,14 @@
+# QtTest benchmark replaying long playback sessions on a virtual clock.
+# Run with e.g. "tst_playbackbench" or "tst_playbackbench -csv".
+
+QT = core testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_playbackbench
+
+include(../../gamecore.pri)
+
+SOURCES += \
+    tst_playbackbench.cpp
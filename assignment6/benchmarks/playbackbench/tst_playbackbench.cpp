@@ -0,0 +1,110 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * tst_playbackbench.cpp
+ *
+ * QtTest benchmarks that replay whole playback sessions on a VirtualClock:
+ *  - replaySession plays every round of a session of up to 500 rounds
+ *    through the FrameDriver and the PlaybackScheduler, which would take
+ *    hours on the wall clock, and reports the intended (virtual) duration
+ *    next to the real time spent, so the scheduling overhead per frame can
+ *    be read off directly.
+ *  - animations runs one bounce animation per round of such a session on
+ *    the same frame loop.
+ */
+
+#include <QtTest>
+#include <QElapsedTimer>
+#include <QVariantAnimation>
+#include "framedriver.h"
+#include "playbackscheduler.h"
+#include "simoncore.h"
+#include "virtualclock.h"
+
+class PlaybackBench : public QObject {
+    Q_OBJECT
+
+private slots:
+    void replaySession_data();
+    void replaySession();
+    void animations_data();
+    void animations();
+};
+
+void PlaybackBench::replaySession_data() {
+    QTest::addColumn<int>("rounds");
+    for (int rounds : {10, 100, 500})
+        QTest::addRow("%d rounds", rounds) << rounds;
+}
+
+void PlaybackBench::replaySession() {
+    QFETCH(int, rounds);
+
+    VirtualClock clock;
+    FrameDriver frames(&clock);
+    PlaybackScheduler scheduler(&frames);
+    qint64 edges = 0;
+    connect(&scheduler, &PlaybackScheduler::flashChanged, this, [&edges](int, bool) { edges++; });
+
+    // Play rounds 1..rounds back to back, jumping straight from one frame to the next.
+    SimonCore<2, PackedStorage> core;
+    core.start(42);
+    QElapsedTimer timer;
+    timer.start();
+    for (int r = 1; r <= rounds; r++) {
+        scheduler.play(core.playbackRound());
+        while (scheduler.isPlaying())
+            clock.advanceToNextTimer();
+        core.advanceRound();
+    }
+    const qint64 ns = timer.nsecsElapsed();
+
+    // Every move of every round is lit once and turned off once.
+    QCOMPARE(edges, qint64(rounds) * (rounds + 1));
+
+    qInfo("%s: %.1f virtual minutes replayed in %.3f ms, %lld frames, %.1f ns/frame",
+          QTest::currentDataTag(), clock.nowMs() / 60000.0, ns / 1e6,
+          frames.frameCount(), double(ns) / frames.frameCount());
+    QTest::setBenchmarkResult(qreal(ns) / frames.frameCount(), QTest::WalltimeNanoseconds);
+}
+
+void PlaybackBench::animations_data() {
+    replaySession_data();
+}
+
+void PlaybackBench::animations() {
+    QFETCH(int, rounds);
+
+    VirtualClock clock;
+    FrameDriver frames(&clock);
+    frames.installAnimationDriver();
+
+    // One pad-like bounce per round, advanced one frame at a time.
+    QElapsedTimer timer;
+    timer.start();
+    for (int r = 0; r < rounds; r++) {
+        QVariantAnimation anim;
+        anim.setDuration(1000);
+        anim.setStartValue(QPoint(0, 0));
+        anim.setEndValue(QPoint(300, 200));
+        anim.setEasingCurve(QEasingCurve::OutBounce);
+        anim.start();
+        // Qt registers new animations with its timer on the next pass of the event loop.
+        QCoreApplication::processEvents();
+        while (anim.state() == QAbstractAnimation::Running && clock.advanceToNextTimer()) {}
+        QCOMPARE(anim.currentValue().toPoint(), QPoint(300, 200));
+    }
+    const qint64 ns = timer.nsecsElapsed();
+
+    qInfo("%s: %.1f virtual seconds of animation in %.3f ms, %lld frames, %.1f ns/frame",
+          QTest::currentDataTag(), clock.nowMs() / 1000.0, ns / 1e6, frames.frameCount(),
+          double(ns) / frames.frameCount());
+    QTest::setBenchmarkResult(qreal(ns) / frames.frameCount(), QTest::WalltimeNanoseconds);
+}
+
+QTEST_GUILESS_MAIN(PlaybackBench)
+
+#include "tst_playbackbench.moc"
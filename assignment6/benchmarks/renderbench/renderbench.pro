@@ -0,0 +1,35 @@
+# QtTest benchmark of one frame of the MainWindow board, rendered offscreen.
+# Runs on the offscreen platform unless QT_QPA_PLATFORM is set, e.g.
+# "tst_renderbench" or "QT_QPA_PLATFORM=offscreen tst_renderbench -csv".
+
+QT += core gui widgets testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_renderbench
+
+include(../../gamecore.pri)
+
+# The window under test, built from the application's own sources.
+SOURCES += \
+    ../../boardwidget.cpp \
+    ../../mainwindow.cpp \
+    ../../padanimator.cpp \
+    ../../padinput.cpp \
+    ../../placementengine.cpp \
+    ../../shadowcache.cpp \
+    ../../simonpad.cpp \
+    tst_renderbench.cpp
+
+HEADERS += \
+    ../../boardwidget.h \
+    ../../mainwindow.h \
+    ../../padanimator.h \
+    ../../padinput.h \
+    ../../placementengine.h \
+    ../../shadowcache.h \
+    ../../simonpad.h
+
+FORMS += \
+    ../../mainwindow.ui
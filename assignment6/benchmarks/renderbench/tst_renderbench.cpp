@@ -0,0 +1,188 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * tst_renderbench.cpp
+ *
+ * QtTest benchmarks of what one frame of the MainWindow board costs,
+ * rendered on the offscreen platform so the numbers do not depend on a
+ * display. Every row builds a MainWindow at 800x600 and times grab() (a
+ * full render of the window into a pixmap) and repaint() of the board in
+ * one configuration:
+ *  - with the board's cached gradient, the qlineargradient style sheet it
+ *    replaced, or no background at all,
+ *  - with cached board shadows, no shadows, or one live
+ *    QGraphicsDropShadowEffect per button as before the shadow cache,
+ *  - with a pad flashed,
+ *  - halfway through animateButtonMovement(), with the animations frozen
+ *    on a VirtualClock.
+ */
+
+#include <QtTest>
+#include <QApplication>
+#include <QGraphicsDropShadowEffect>
+#include <QPushButton>
+#include "boardwidget.h"
+#include "mainwindow.h"
+#include "model.h"
+#include "simonpad.h"
+#include "virtualclock.h"
+
+namespace {
+
+/**
+ * @brief How the board's background gradient is drawn.
+ */
+enum class Background {
+    None,      ///< No gradient at all.
+    Cached,    ///< Rendered once and blitted by the board (the game's setup).
+    StyleSheet ///< A qlineargradient style sheet, rasterized every paint.
+};
+
+/**
+ * @brief How the buttons' drop shadows are drawn.
+ */
+enum class Shadows {
+    None,   ///< No shadows at all.
+    Cached, ///< Blurred once and blitted by the board (the game's setup).
+    Effect  ///< One QGraphicsDropShadowEffect per button, blurred every paint.
+};
+
+}
+
+Q_DECLARE_METATYPE(Background)
+Q_DECLARE_METATYPE(Shadows)
+
+class RenderBench : public QObject {
+    Q_OBJECT
+
+private slots:
+    void grab_data() { addRows(); }
+    void grab();
+    void repaint_data() { addRows(); }
+    void repaint();
+
+private:
+    static void addRows();
+
+    /**
+     * @brief Builds the window for the current row and shows it.
+     */
+    static void setUpWindow(MainWindow &window, VirtualClock &clock);
+};
+
+void RenderBench::addRows() {
+    QTest::addColumn<Background>("background");
+    QTest::addColumn<Shadows>("shadows");
+    QTest::addColumn<bool>("flash");
+    QTest::addColumn<bool>("midAnimation");
+
+    QTest::newRow("gradient, cached shadows") << Background::Cached << Shadows::Cached << false << false;
+    QTest::newRow("style sheet gradient, cached shadows") << Background::StyleSheet << Shadows::Cached << false << false;
+    QTest::newRow("no gradient, cached shadows") << Background::None << Shadows::Cached << false << false;
+    QTest::newRow("gradient, no shadows") << Background::Cached << Shadows::None << false << false;
+    QTest::newRow("no gradient, no shadows") << Background::None << Shadows::None << false << false;
+    QTest::newRow("gradient, effect shadows") << Background::Cached << Shadows::Effect << false << false;
+    QTest::newRow("no gradient, effect shadows") << Background::None << Shadows::Effect << false << false;
+    QTest::newRow("gradient, cached shadows, flash") << Background::Cached << Shadows::Cached << true << false;
+    QTest::newRow("style sheet gradient, cached shadows, flash") << Background::StyleSheet << Shadows::Cached << true << false;
+    QTest::newRow("gradient, cached shadows, mid-animation") << Background::Cached << Shadows::Cached << false << true;
+    QTest::newRow("style sheet gradient, cached shadows, mid-animation") << Background::StyleSheet << Shadows::Cached << false << true;
+    QTest::newRow("gradient, effect shadows, mid-animation") << Background::Cached << Shadows::Effect << false << true;
+}
+
+void RenderBench::setUpWindow(MainWindow &window, VirtualClock &clock) {
+    QFETCH(Background, background);
+    QFETCH(Shadows, shadows);
+    QFETCH(bool, flash);
+    QFETCH(bool, midAnimation);
+
+    window.resize(800, 600);
+    BoardWidget *board = window.findChild<BoardWidget*>("centralwidget");
+    QVERIFY(board);
+    const QList<QPushButton*> buttons = {
+        window.findChild<QPushButton*>("startButton"),
+        window.findChild<QPushButton*>("redButton"),
+        window.findChild<QPushButton*>("blueButton"),
+    };
+
+    if (background != Background::Cached)
+        board->clearBackgroundGradient();
+    if (background == Background::StyleSheet) {
+        // The setup the board's cached gradient replaced.
+        board->setStyleSheet(
+            "background: qlineargradient(x1:0, y1:0, x2:0, y2:1, stop:0 #f0f8ff, stop:1 #87cefa);"
+            );
+    }
+    if (shadows != Shadows::Cached) {
+        for (QPushButton *button : buttons)
+            board->removeShadowCaster(button);
+    }
+    if (shadows == Shadows::Effect) {
+        // The setup the board's shadow cache replaced.
+        for (QPushButton *button : buttons) {
+            QGraphicsDropShadowEffect *effect = new QGraphicsDropShadowEffect(button);
+            effect->setBlurRadius(10);
+            effect->setOffset(3, 3);
+            effect->setColor(QColor(0, 0, 0, 150));
+            button->setGraphicsEffect(effect);
+        }
+    }
+    if (flash)
+        window.findChild<SimonPad*>("redButton")->setFlashed(true);
+
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    if (midAnimation) {
+        window.animateButtonMovement();
+        // Qt starts new animations on the next pass of the event loop.
+        QCoreApplication::processEvents();
+        // Stop halfway through the 1000 ms bounce; the clock stands still while measuring.
+        clock.advance(500);
+    }
+    // Settle pending layout and paint work before timing.
+    QCoreApplication::processEvents();
+}
+
+void RenderBench::grab() {
+    Model model;
+    VirtualClock clock;
+    MainWindow window(&model, &clock);
+    setUpWindow(window, clock);
+    if (QTest::currentTestFailed())
+        return;
+
+    QBENCHMARK {
+        QPixmap frame = window.grab();
+        Q_UNUSED(frame);
+    }
+}
+
+void RenderBench::repaint() {
+    Model model;
+    VirtualClock clock;
+    MainWindow window(&model, &clock);
+    setUpWindow(window, clock);
+    if (QTest::currentTestFailed())
+        return;
+
+    // Repaints the whole board synchronously, like a full-frame update on the device.
+    BoardWidget *board = window.findChild<BoardWidget*>("centralwidget");
+    QBENCHMARK {
+        board->repaint();
+    }
+}
+
+int main(int argc, char *argv[]) {
+    // Render without a display unless a platform was chosen explicitly.
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+    RenderBench bench;
+    return QTest::qExec(&bench, argc, argv);
+}
+
+#include "tst_renderbench.moc"
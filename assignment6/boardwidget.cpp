@@ -0,0 +1,146 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * boardwidget.cpp
+ *
+ * This file implements the BoardWidget. The background gradient and the
+ * shadows are blitted from caches during the board's own paint, so a
+ * flashing or moving button never has to be rendered offscreen, blurred or
+ * have the gradient re-rasterized under it.
+ */
+
+#include "boardwidget.h"
+#include "tracer.h"
+#include <QLinearGradient>
+#include <QMoveEvent>
+#include <QPainter>
+#include <QResizeEvent>
+#include <QStyle>
+#include <QStyleOption>
+
+BoardWidget::BoardWidget(QWidget *parent)
+    : QWidget(parent),
+    m_hasGradient(false)
+{
+}
+
+void BoardWidget::setBackgroundGradient(const QColor &top, const QColor &bottom) {
+    m_hasGradient = true;
+    m_gradientTop = top;
+    m_gradientBottom = bottom;
+    m_background = QPixmap();
+    // The gradient covers every pixel, so Qt does not need to clear them first.
+    setAttribute(Qt::WA_OpaquePaintEvent, top.alpha() == 255 && bottom.alpha() == 255);
+    update();
+}
+
+void BoardWidget::clearBackgroundGradient() {
+    m_hasGradient = false;
+    m_background = QPixmap();
+    setAttribute(Qt::WA_OpaquePaintEvent, false);
+    update();
+}
+
+const QPixmap &BoardWidget::background() {
+    const qreal dpr = devicePixelRatioF();
+    // Rasterize once per size and pixel ratio; resizeEvent() drops the old one.
+    if (m_background.isNull() || m_background.devicePixelRatio() != dpr) {
+        m_background = QPixmap(size() * dpr);
+        m_background.setDevicePixelRatio(dpr);
+        QLinearGradient gradient(0, 0, 0, height());
+        gradient.setColorAt(0, m_gradientTop);
+        gradient.setColorAt(1, m_gradientBottom);
+        m_background.fill(Qt::transparent);
+        QPainter painter(&m_background);
+        painter.fillRect(rect(), gradient);
+    }
+    return m_background;
+}
+
+void BoardWidget::addShadowCaster(QWidget *widget, int cornerRadius) {
+    Q_ASSERT(widget->parentWidget() == this);
+    m_casters.append({ widget, cornerRadius });
+    widget->installEventFilter(this);
+    update(m_shadows.shadowRect(widget->geometry()));
+}
+
+void BoardWidget::removeShadowCaster(QWidget *widget) {
+    for (int i = 0; i < m_casters.size(); i++) {
+        if (m_casters[i].widget != widget)
+            continue;
+        widget->removeEventFilter(this);
+        update(m_shadows.shadowRect(widget->geometry()));
+        m_casters.remove(i);
+        return;
+    }
+}
+
+void BoardWidget::paintEvent(QPaintEvent *event) {
+    Tracer::Scope trace("BoardWidget::paintEvent", "paint");
+    QPainter painter(this);
+
+    if (m_hasGradient) {
+        // Copy only the dirty pixels of the cached gradient.
+        const QPixmap &pixmap = background();
+        const qreal dpr = pixmap.devicePixelRatio();
+        for (const QRect &rect : event->region()) {
+            const QRectF source(rect.x() * dpr, rect.y() * dpr, rect.width() * dpr, rect.height() * dpr);
+            painter.drawPixmap(QRectF(rect), pixmap, source);
+        }
+    } else {
+        // Let the style sheet draw the background, as a plain QWidget would.
+        QStyleOption option;
+        option.initFrom(this);
+        style()->drawPrimitive(QStyle::PE_Widget, &option, &painter, this);
+    }
+
+    // Blit the cached shadows that intersect the dirty area.
+    const qreal dpr = devicePixelRatioF();
+    for (const Caster &caster : std::as_const(m_casters)) {
+        QWidget *widget = caster.widget;
+        if (!widget->isVisible())
+            continue;
+        if (!event->rect().intersects(m_shadows.shadowRect(widget->geometry())))
+            continue;
+        painter.drawPixmap(m_shadows.shadowOrigin(widget->pos()),
+                           m_shadows.shadow(widget->size(), caster.cornerRadius, dpr));
+    }
+}
+
+void BoardWidget::resizeEvent(QResizeEvent *event) {
+    // The gradient stretches over the whole board; render it again at the new size.
+    m_background = QPixmap();
+    QWidget::resizeEvent(event);
+}
+
+bool BoardWidget::eventFilter(QObject *watched, QEvent *event) {
+    QWidget *widget = qobject_cast<QWidget *>(watched);
+    if (!widget)
+        return QWidget::eventFilter(watched, event);
+
+    switch (event->type()) {
+    case QEvent::Move: {
+        // Repaint where the shadow was and where it is now.
+        auto *move = static_cast<QMoveEvent *>(event);
+        update(m_shadows.shadowRect(QRect(move->oldPos(), widget->size())));
+        update(m_shadows.shadowRect(widget->geometry()));
+        break;
+    }
+    case QEvent::Resize: {
+        auto *resize = static_cast<QResizeEvent *>(event);
+        update(m_shadows.shadowRect(QRect(widget->pos(), resize->oldSize())));
+        update(m_shadows.shadowRect(widget->geometry()));
+        break;
+    }
+    case QEvent::Show:
+    case QEvent::Hide:
+        update(m_shadows.shadowRect(widget->geometry()));
+        break;
+    default:
+        break;
+    }
+    return QWidget::eventFilter(watched, event);
+}
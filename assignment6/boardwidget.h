@@ -0,0 +1,114 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * boardwidget.h
+ *
+ * This file declares the BoardWidget, the central widget of the Simon
+ * window that the buttons are placed on. The board paints its background
+ * gradient and the drop shadows of the buttons registered with it from a
+ * ShadowCache, underneath all of its children. The board follows the moves
+ * and resizes of those buttons and only repaints the shadow areas they
+ * leave and enter.
+ *
+ * The gradient is rasterized once per board size and pixel ratio into a
+ * pixmap; a repaint under a flashing or moving button only copies the
+ * dirty pixels of that pixmap. Without a gradient, the style sheet
+ * background is drawn as for a plain QWidget.
+ *
+ * Usage:
+ *  - Promote the central widget to BoardWidget in Qt Designer (header boardwidget.h).
+ *  - Call setBackgroundGradient() instead of a qlineargradient style sheet.
+ *  - Call addShadowCaster() for every button that should cast a shadow.
+ */
+
+#ifndef BOARDWIDGET_H
+#define BOARDWIDGET_H
+
+#include <QPixmap>
+#include <QVector>
+#include <QWidget>
+#include "shadowcache.h"
+
+class BoardWidget : public QWidget {
+    Q_OBJECT
+public:
+    /**
+     * @brief Constructs an empty board.
+     * @param parent Optional parent widget.
+     */
+    explicit BoardWidget(QWidget *parent = nullptr);
+
+    /**
+     * @brief Makes a child widget cast a cached drop shadow on the board.
+     * @param widget A direct child of the board.
+     * @param cornerRadius Corner radius of the widget's shape.
+     */
+    void addShadowCaster(QWidget *widget, int cornerRadius);
+
+    /**
+     * @brief Stops drawing a widget's shadow, e.g. before the widget is deleted.
+     * @param widget A widget previously passed to addShadowCaster().
+     */
+    void removeShadowCaster(QWidget *widget);
+
+    /**
+     * @brief Returns the cache the shadows are drawn from, to configure their look.
+     */
+    ShadowCache &shadowCache() { return m_shadows; }
+
+    /**
+     * @brief Paints the board with a cached vertical gradient.
+     * @param top Color at the top edge.
+     * @param bottom Color at the bottom edge.
+     */
+    void setBackgroundGradient(const QColor &top, const QColor &bottom);
+
+    /**
+     * @brief Removes the gradient; the style sheet background is drawn again.
+     */
+    void clearBackgroundGradient();
+
+protected:
+    /**
+     * @brief Paints the style sheet background and the cached shadows.
+     * @param event Pointer to the QPaintEvent.
+     */
+    void paintEvent(QPaintEvent *event) override;
+
+    /**
+     * @brief Drops the cached gradient, which no longer fits the board.
+     * @param event Pointer to the QResizeEvent.
+     */
+    void resizeEvent(QResizeEvent *event) override;
+
+    /**
+     * @brief Repaints the shadow areas of casters that move, resize, show or hide.
+     */
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    /**
+     * @brief A widget casting a shadow.
+     */
+    struct Caster {
+        QWidget *widget;  ///< The widget.
+        int cornerRadius; ///< Corner radius of its shape.
+    };
+
+    /**
+     * @brief Returns the gradient rendered at the board's size and pixel ratio.
+     */
+    const QPixmap &background();
+
+    ShadowCache m_shadows;     ///< Blurred shadows by size and pixel ratio.
+    QVector<Caster> m_casters; ///< Widgets casting a shadow, in registration order.
+    bool m_hasGradient;        ///< True if the board paints a gradient background.
+    QColor m_gradientTop;      ///< Gradient color at the top edge.
+    QColor m_gradientBottom;   ///< Gradient color at the bottom edge.
+    QPixmap m_background;      ///< The rendered gradient; null until painted or after a resize.
+};
+
+#endif // BOARDWIDGET_H
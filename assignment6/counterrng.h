@@ -0,0 +1,79 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * counterrng.h
+ *
+ * This file declares CounterRng, a seeded counter-based random generator
+ * for the Simon sequence. Output i is a pure function of (seed, i): the
+ * counter is spread with the golden-ratio increment used by SplitMix64 and
+ * then scrambled by the SplitMix64 finalizer. Nothing is shared between
+ * instances, so any number of Models can draw moves in parallel threads and
+ * any move of a game can be recomputed in O(1) from its seed.
+ */
+
+#ifndef COUNTERRNG_H
+#define COUNTERRNG_H
+
+#include <QtGlobal>
+
+class CounterRng {
+public:
+    /**
+     * @brief Constructs a generator for the given seed.
+     * @param seed The seed of the game.
+     */
+    constexpr explicit CounterRng(quint64 seed) : m_seed(seed) {}
+
+    /**
+     * @brief Returns the seed of the generator.
+     */
+    constexpr quint64 seed() const { return m_seed; }
+
+    /**
+     * @brief Returns the 64-bit random value at the given counter.
+     * @param counter Index of the value.
+     */
+    constexpr quint64 operator()(quint64 counter) const { return valueAt(m_seed, counter); }
+
+    /**
+     * @brief Returns the move at the given index.
+     * @param index Index of the move in the sequence.
+     * @param colors Number of colors in the game.
+     * @return The color index of the move, in [0, colors).
+     */
+    constexpr int move(quint64 index, int colors = 2) const { return moveAt(m_seed, index, colors); }
+
+    /**
+     * @brief Returns the 64-bit random value for (seed, counter).
+     */
+    static constexpr quint64 valueAt(quint64 seed, quint64 counter) {
+        return mix(seed + (counter + 1) * 0x9e3779b97f4a7c15ull);
+    }
+
+    /**
+     * @brief Returns the move for (seed, index) in a game with the given number of colors.
+     *
+     * The high 32 bits are mapped onto [0, colors) with a multiply and a
+     * shift, so the two-color game uses the top bit (0 for Red, 1 for Blue).
+     */
+    static constexpr int moveAt(quint64 seed, quint64 index, int colors = 2) {
+        return static_cast<int>(((valueAt(seed, index) >> 32) * static_cast<quint64>(colors)) >> 32);
+    }
+
+private:
+    /**
+     * @brief The SplitMix64 finalizer.
+     */
+    static constexpr quint64 mix(quint64 z) {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    quint64 m_seed; ///< The seed of the game.
+};
+
+#endif // COUNTERRNG_H
@@ -0,0 +1,61 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * framedriver.cpp
+ *
+ * This file implements the FrameDriver. Running animations take a hold on
+ * the driver through the animation driver's started() and stopped()
+ * signals, so an idle board costs no timer events at all.
+ */
+
+#include "framedriver.h"
+#include "tracer.h"
+
+FrameDriver::FrameDriver(Clock *clock, QObject *parent)
+    : QObject(parent),
+    m_clock(clock),
+    m_timer(clock->createTimer(this)),
+    m_driver(nullptr),
+    m_holds(0),
+    m_frameCount(0)
+{
+    connect(m_timer, &GameTimer::timeout, this, &FrameDriver::tick);
+}
+
+FrameDriver::~FrameDriver() {
+    if (m_driver)
+        m_driver->uninstall();
+}
+
+void FrameDriver::installAnimationDriver() {
+    if (m_driver)
+        return;
+    m_driver = new ClockAnimationDriver(m_clock, this);
+    // Qt starts the driver when the first animation runs and stops it after the last.
+    connect(m_driver, &QAnimationDriver::started, this, &FrameDriver::hold);
+    connect(m_driver, &QAnimationDriver::stopped, this, &FrameDriver::release);
+    m_driver->install();
+}
+
+void FrameDriver::hold() {
+    if (m_holds++ == 0)
+        m_timer->start(FrameMs);
+}
+
+void FrameDriver::release() {
+    Q_ASSERT(m_holds > 0);
+    if (--m_holds == 0)
+        m_timer->stop();
+}
+
+void FrameDriver::tick() {
+    Tracer::Scope trace("FrameDriver::tick", "timer");
+    // Step the frame's state first, then move the animations to the same instant;
+    // the widget updates of both are painted together on the next pass.
+    emit frame(m_frameCount++);
+    if (m_driver && m_driver->isRunning())
+        m_driver->advance();
+}
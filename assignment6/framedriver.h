@@ -0,0 +1,103 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * framedriver.h
+ *
+ * This file declares the FrameDriver, the fixed-timestep loop every piece
+ * of game timing runs on. One timer from the Clock ticks every FrameMs
+ * milliseconds; each tick first emits frame(), on which the playback
+ * scheduler steps its flashes, and then advances Qt's animations through a
+ * ClockAnimationDriver. Flash edges and pad motion therefore land on the
+ * same frames, and the widget updates of one frame are painted together.
+ *
+ * The timer only runs while someone needs frames: a client calls hold()
+ * when it starts and release() when it is done, and running animations
+ * hold the driver automatically.
+ *
+ * Usage:
+ *  - FrameDriver frames(clock); frames.installAnimationDriver();
+ *  - Connect to frame() and wrap the work in hold()/release().
+ */
+
+#ifndef FRAMEDRIVER_H
+#define FRAMEDRIVER_H
+
+#include <QObject>
+#include "gameclock.h"
+
+class FrameDriver : public QObject {
+    Q_OBJECT
+public:
+    /// Length of a frame in milliseconds (about 60 frames per second).
+    static constexpr int FrameMs = 16;
+
+    /**
+     * @brief Constructs an idle driver.
+     * @param clock The clock the frame timer is created from; must outlive the driver.
+     * @param parent Optional parent QObject.
+     */
+    explicit FrameDriver(Clock *clock, QObject *parent = nullptr);
+
+    /**
+     * @brief Uninstalls the animation driver, if installed.
+     */
+    ~FrameDriver() override;
+
+    /**
+     * @brief Returns the clock the frames are timed by.
+     */
+    Clock *clock() const { return m_clock; }
+
+    /**
+     * @brief Returns the number of frames ticked so far.
+     */
+    qint64 frameCount() const { return m_frameCount; }
+
+    /**
+     * @brief Returns true while the frame timer runs.
+     */
+    bool isRunning() const { return m_timer->isActive(); }
+
+    /**
+     * @brief Advances Qt's animations of the current thread on the frames.
+     *
+     * Replaces Qt's animation timer, so QPropertyAnimations move exactly
+     * once per frame, after the frame() receivers.
+     */
+    void installAnimationDriver();
+
+    /**
+     * @brief Keeps frames coming until the matching release().
+     */
+    void hold();
+
+    /**
+     * @brief Gives back a hold(); the timer stops when nothing holds it.
+     */
+    void release();
+
+signals:
+    /**
+     * @brief Emitted once per frame, before the animations advance.
+     * @param frame Index of the frame since the driver was created.
+     */
+    void frame(qint64 frame);
+
+private slots:
+    /**
+     * @brief Runs one frame.
+     */
+    void tick();
+
+private:
+    Clock *m_clock;                 ///< The clock the frames are timed by.
+    GameTimer *m_timer;             ///< The frame timer.
+    ClockAnimationDriver *m_driver; ///< Installed animation driver, or nullptr.
+    int m_holds;                    ///< Number of outstanding hold() calls.
+    qint64 m_frameCount;            ///< Frames ticked so far.
+};
+
+#endif // FRAMEDRIVER_H
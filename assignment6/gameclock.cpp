@@ -0,0 +1,66 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * gameclock.cpp
+ *
+ * This file implements the SystemClock, the QTimer-backed timers it
+ * creates and the ClockAnimationDriver.
+ */
+
+#include "gameclock.h"
+
+namespace {
+
+/**
+ * @brief A GameTimer forwarding to a precise QTimer.
+ */
+class SystemTimer : public GameTimer {
+public:
+    explicit SystemTimer(QObject *parent)
+        : GameTimer(parent) {
+        m_timer.setTimerType(Qt::PreciseTimer);
+        connect(&m_timer, &QTimer::timeout, this, &GameTimer::timeout);
+    }
+
+    void start(int ms) override { m_timer.start(ms); }
+    void setInterval(int ms) override { m_timer.setInterval(ms); }
+    void setSingleShot(bool singleShot) override { m_timer.setSingleShot(singleShot); }
+    void stop() override { m_timer.stop(); }
+    bool isActive() const override { return m_timer.isActive(); }
+
+private:
+    QTimer m_timer; ///< The timer doing the work.
+};
+
+}
+
+SystemClock::SystemClock(QObject *parent)
+    : Clock(parent)
+{
+    m_elapsed.start();
+}
+
+SystemClock *SystemClock::instance() {
+    static SystemClock clock;
+    return &clock;
+}
+
+GameTimer *SystemClock::createTimer(QObject *parent) {
+    return new SystemTimer(parent);
+}
+
+ClockAnimationDriver::ClockAnimationDriver(Clock *clock, QObject *parent)
+    : QAnimationDriver(parent),
+    m_clock(clock),
+    m_startMs(0)
+{
+}
+
+void ClockAnimationDriver::start() {
+    // Qt expects elapsed() to count from the start of the driver.
+    m_startMs = m_clock->nowMs();
+    QAnimationDriver::start();
+}
@@ -0,0 +1,157 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * gameclock.h
+ *
+ * This file declares the clock and timer service the game's timing runs on.
+ * The frame loop and the view never create a QTimer or read the wall
+ * clock themselves; they ask a Clock for the time and for timers. The
+ * SystemClock is backed by QElapsedTimer and QTimer, while a VirtualClock
+ * (virtualclock.h) only moves when told to, so tests and benchmarks can
+ * replay hours of playback in milliseconds.
+ *
+ * Usage:
+ *  - Pass a Clock to the FrameDriver (or MainWindow); without one the window
+ *    uses SystemClock::instance().
+ *  - Create timers with createTimer() and use them like a QTimer.
+ *  - A ClockAnimationDriver runs Qt's animations on a Clock, advancing them
+ *    only when its owner (the FrameDriver) calls advance().
+ */
+
+#ifndef GAMECLOCK_H
+#define GAMECLOCK_H
+
+#include <QAnimationDriver>
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+
+/**
+ * @brief A timer created by a Clock, with the subset of the QTimer API the game uses.
+ *
+ * Timers repeat by default. Changing the interval of an active timer
+ * restarts it, exactly like QTimer::setInterval().
+ */
+class GameTimer : public QObject {
+    Q_OBJECT
+public:
+    using QObject::QObject;
+
+    /**
+     * @brief Starts or restarts the timer.
+     * @param ms The interval in milliseconds.
+     */
+    virtual void start(int ms) = 0;
+
+    /**
+     * @brief Changes the interval; an active timer restarts with it.
+     * @param ms The interval in milliseconds.
+     */
+    virtual void setInterval(int ms) = 0;
+
+    /**
+     * @brief Makes the timer fire only once per start().
+     */
+    virtual void setSingleShot(bool singleShot) = 0;
+
+    /**
+     * @brief Stops the timer.
+     */
+    virtual void stop() = 0;
+
+    /**
+     * @brief Returns true while the timer is running.
+     */
+    virtual bool isActive() const = 0;
+
+signals:
+    /**
+     * @brief Emitted when the timer expires.
+     */
+    void timeout();
+};
+
+/**
+ * @brief The source of time and timers for the game.
+ */
+class Clock : public QObject {
+    Q_OBJECT
+public:
+    using QObject::QObject;
+
+    /**
+     * @brief Returns the time since the clock started, in milliseconds.
+     */
+    virtual qint64 nowMs() const = 0;
+
+    /**
+     * @brief Creates an inactive timer driven by this clock.
+     * @param parent Owner of the timer.
+     */
+    virtual GameTimer *createTimer(QObject *parent) = 0;
+};
+
+/**
+ * @brief The wall clock: QElapsedTimer for the time and precise QTimers for timers.
+ */
+class SystemClock : public Clock {
+    Q_OBJECT
+public:
+    /**
+     * @brief Constructs a clock that starts counting now.
+     * @param parent Optional parent QObject.
+     */
+    explicit SystemClock(QObject *parent = nullptr);
+
+    /**
+     * @brief Returns the clock shared by everything that was not given a clock.
+     */
+    static SystemClock *instance();
+
+    qint64 nowMs() const override { return m_elapsed.elapsed(); }
+    GameTimer *createTimer(QObject *parent) override;
+
+    /**
+     * @brief Returns the time since the clock started, in microseconds.
+     *
+     * Input and the replay journal are stamped with this time, so their
+     * times can be compared.
+     */
+    qint64 nowUs() const { return m_elapsed.nsecsElapsed() / 1000; }
+
+private:
+    QElapsedTimer m_elapsed; ///< Started when the clock is constructed.
+};
+
+/**
+ * @brief Drives Qt's animations from a Clock instead of Qt's own animation timer.
+ *
+ * Once installed, animations of the current thread only progress when
+ * advance() is called, and they see the clock's time.
+ */
+class ClockAnimationDriver : public QAnimationDriver {
+public:
+    /**
+     * @brief Constructs an uninstalled driver.
+     * @param clock The clock the animations follow.
+     * @param parent Optional parent QObject.
+     */
+    explicit ClockAnimationDriver(Clock *clock, QObject *parent = nullptr);
+
+    /**
+     * @brief Returns the clock time since the driver was started.
+     */
+    qint64 elapsed() const override { return m_clock->nowMs() - m_startMs; }
+
+protected:
+    void start() override;
+
+private:
+    Clock *m_clock;   ///< The clock the animations follow.
+    qint64 m_startMs; ///< Clock time when Qt last started the driver.
+};
+
+#endif // GAMECLOCK_H
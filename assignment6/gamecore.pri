@@ -0,0 +1,37 @@
+# Game logic shared by the Simon window and the headless tools.
+# Only needs QtCore.
+
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+SOURCES += \
+    $$PWD/framedriver.cpp \
+    $$PWD/gameclock.cpp \
+    $$PWD/latencyhistogram.cpp \
+    $$PWD/latencyprobe.cpp \
+    $$PWD/model.cpp \
+    $$PWD/playbackscheduler.cpp \
+    $$PWD/replayreader.cpp \
+    $$PWD/replaywriter.cpp \
+    $$PWD/tracer.cpp \
+    $$PWD/virtualclock.cpp
+
+HEADERS += \
+    $$PWD/counterrng.h \
+    $$PWD/framedriver.h \
+    $$PWD/gameclock.h \
+    $$PWD/latencyhistogram.h \
+    $$PWD/latencyprobe.h \
+    $$PWD/model.h \
+    $$PWD/movesequence.h \
+    $$PWD/padcolor.h \
+    $$PWD/playbackround.h \
+    $$PWD/playbackscheduler.h \
+    $$PWD/pressbatchresult.h \
+    $$PWD/replayformat.h \
+    $$PWD/replayreader.h \
+    $$PWD/replaywriter.h \
+    $$PWD/roundstate.h \
+    $$PWD/simoncore.h \
+    $$PWD/tracer.h \
+    $$PWD/virtualclock.h
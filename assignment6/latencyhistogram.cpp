@@ -0,0 +1,82 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * latencyhistogram.cpp
+ *
+ * This file implements the LatencyHistogram class. A value's bucket is
+ * found from the position of its highest set bit and the SubBucketBits
+ * bits below it.
+ */
+
+#include "latencyhistogram.h"
+#include <QtAlgorithms>
+#include <cmath>
+
+LatencyHistogram::LatencyHistogram()
+    : m_counts(BucketCount, 0),
+    m_count(0),
+    m_min(0),
+    m_max(0),
+    m_sum(0)
+{
+}
+
+int LatencyHistogram::bucketFor(quint64 ns) {
+    // Small values are counted exactly.
+    if (ns < quint64(SubBucketCount))
+        return int(ns);
+    // Keep the top SubBucketBits + 1 bits; the highest one is always set.
+    const int highestBit = 63 - qCountLeadingZeroBits(ns);
+    const int shift = highestBit - SubBucketBits;
+    return (shift + 1) * SubBucketCount + int(ns >> shift) - SubBucketCount;
+}
+
+qint64 LatencyHistogram::highestValueIn(int bucket) {
+    if (bucket < SubBucketCount)
+        return bucket;
+    const int shift = bucket / SubBucketCount - 1;
+    const qint64 mantissa = bucket % SubBucketCount + SubBucketCount;
+    return ((mantissa + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(qint64 ns) {
+    ns = qBound(qint64(0), ns, (qint64(1) << MaxValueBits) - 1);
+    m_counts[bucketFor(quint64(ns))]++;
+    m_min = m_count ? qMin(m_min, ns) : ns;
+    m_max = qMax(m_max, ns);
+    m_sum += ns;
+    m_count++;
+}
+
+void LatencyHistogram::reset() {
+    m_counts.fill(0);
+    m_count = 0;
+    m_min = 0;
+    m_max = 0;
+    m_sum = 0;
+}
+
+qint64 LatencyHistogram::valueAtPercentile(double percentile) const {
+    if (m_count == 0)
+        return 0;
+    // The rank of the sample at the percentile, counting from 1.
+    const double share = qBound(0.0, percentile, 100.0) / 100.0;
+    const quint64 rank = qMax<quint64>(1, quint64(std::ceil(share * m_count)));
+    quint64 seen = 0;
+    for (int bucket = 0; bucket < BucketCount; bucket++) {
+        seen += m_counts[bucket];
+        if (seen >= rank)
+            return qMin(highestValueIn(bucket), m_max);
+    }
+    return m_max;
+}
+
+QString LatencyHistogram::summary(const QString &name) const {
+    return QString::asprintf("%-16s n=%-8llu p50=%9.1f us  p99=%9.1f us  p99.9=%9.1f us  max=%9.1f us",
+                             qPrintable(name), static_cast<unsigned long long>(m_count),
+                             valueAtPercentile(50) / 1000.0, valueAtPercentile(99) / 1000.0,
+                             valueAtPercentile(99.9) / 1000.0, m_max / 1000.0);
+}
@@ -0,0 +1,116 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * latencyhistogram.h
+ *
+ * This file declares the LatencyHistogram class used to measure the Simon
+ * game's input latency. Like an HDR histogram, it counts nanosecond samples
+ * in log-linear buckets: values below 128 ns get one bucket each, and every
+ * power of two above that is split into 128 buckets, so any value is known
+ * to within 1/128 (under 0.8%) of itself. All buckets are allocated up
+ * front; record() is a bit scan and an increment, cheap enough for the
+ * input path.
+ *
+ * Usage:
+ *  - Call record() with each sample in nanoseconds.
+ *  - Read valueAtPercentile() for p50, p99, p99.9 and so on.
+ */
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+class LatencyHistogram {
+public:
+    /// Bits of precision kept of every sample.
+    static constexpr int SubBucketBits = 7;
+
+    /// Buckets per power of two.
+    static constexpr int SubBucketCount = 1 << SubBucketBits;
+
+    /// Samples are clamped to 2^MaxValueBits - 1 ns (about 18 minutes).
+    static constexpr int MaxValueBits = 40;
+
+    /// Number of buckets covering 0 .. 2^MaxValueBits - 1.
+    static constexpr int BucketCount = (MaxValueBits - SubBucketBits + 1) * SubBucketCount;
+
+    /**
+     * @brief Constructs an empty histogram.
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Counts one sample.
+     * @param ns The latency in nanoseconds; negative values count as 0.
+     */
+    void record(qint64 ns);
+
+    /**
+     * @brief Forgets all samples.
+     */
+    void reset();
+
+    /**
+     * @brief Returns the number of samples.
+     */
+    quint64 count() const { return m_count; }
+
+    /**
+     * @brief Returns the smallest sample, or 0 if there is none.
+     */
+    qint64 min() const { return m_count ? m_min : 0; }
+
+    /**
+     * @brief Returns the largest sample, or 0 if there is none.
+     */
+    qint64 max() const { return m_max; }
+
+    /**
+     * @brief Returns the mean of the samples, or 0 if there is none.
+     */
+    double mean() const { return m_count ? double(m_sum) / m_count : 0.0; }
+
+    /**
+     * @brief Returns the value at or below which a share of the samples fall.
+     *
+     * The result is the highest value of the bucket holding the percentile,
+     * but never more than max().
+     *
+     * @param percentile The share in percent, e.g. 99.9.
+     * @return The latency in nanoseconds, or 0 if there are no samples.
+     */
+    qint64 valueAtPercentile(double percentile) const;
+
+    /**
+     * @brief Returns a one-line summary: count, p50, p99, p99.9 and max in microseconds.
+     * @param name Label put in front of the numbers.
+     */
+    QString summary(const QString &name) const;
+
+    /**
+     * @brief Returns the bucket a value is counted in.
+     * @param ns A value between 0 and 2^MaxValueBits - 1.
+     */
+    static int bucketFor(quint64 ns);
+
+    /**
+     * @brief Returns the highest value counted in a bucket.
+     * @param bucket A bucket index below BucketCount.
+     */
+    static qint64 highestValueIn(int bucket);
+
+private:
+    QVector<quint64> m_counts; ///< Samples per bucket.
+    quint64 m_count;           ///< Number of samples.
+    qint64 m_min;              ///< Smallest sample.
+    qint64 m_max;              ///< Largest sample.
+    qint64 m_sum;              ///< Sum of the samples, for the mean.
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,97 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * latencyprobe.cpp
+ *
+ * This file implements the LatencyProbe class for the Simon game. The
+ * filter sees every event of the application, so it only compares the
+ * event type on the common path and reads the clock for input events and
+ * for paints of the feedback widget. It only uses QEvent, so the probe
+ * stays in the QtCore-only game core next to the Model.
+ */
+
+#include "latencyprobe.h"
+#include <QEvent>
+
+namespace {
+
+/// An input event seen again this soon at the same address is the same event handed to a parent.
+constexpr qint64 PropagationNs = 1000000;
+
+}
+
+LatencyProbe::LatencyProbe(QObject *parent)
+    : QObject(parent),
+    m_inputNs(-1),
+    m_inputType(QEvent::None),
+    m_inputEvent(nullptr),
+    m_entryNs(0),
+    m_paintPendingNs(-1),
+    m_unpainted(0)
+{
+    m_clock.start();
+}
+
+void LatencyProbe::markPressEntry() {
+    m_entryNs = m_clock.nsecsElapsed();
+    if (m_inputNs < 0)
+        return;
+    m_inputToPress.record(m_entryNs - m_inputNs);
+    // The previous press never got its paint; do not time it against this one's.
+    if (m_paintPendingNs >= 0)
+        m_unpainted++;
+    m_paintPendingNs = m_inputNs;
+    m_inputNs = -1;
+}
+
+void LatencyProbe::markPressExit() {
+    m_press.record(m_clock.nsecsElapsed() - m_entryNs);
+}
+
+void LatencyProbe::reset() {
+    m_inputToPress.reset();
+    m_press.reset();
+    m_inputToPaint.reset();
+    m_unpainted = 0;
+    m_paintPendingNs = -1;
+}
+
+QString LatencyProbe::report() const {
+    return m_inputToPress.summary("input -> press") + '\n'
+           + m_press.summary("press") + '\n'
+           + m_inputToPaint.summary("input -> paint") + '\n'
+           + QString("unpainted presses: %1").arg(m_unpainted);
+}
+
+bool LatencyProbe::eventFilter(QObject *watched, QEvent *event) {
+    switch (event->type()) {
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonRelease:
+    case QEvent::KeyPress:
+    case QEvent::KeyRelease:
+    case QEvent::TouchBegin:
+    case QEvent::TouchEnd: {
+        // An event handed on to the parent widget passes the filter again; keep its first time.
+        const qint64 now = m_clock.nsecsElapsed();
+        if (m_inputNs >= 0 && event == m_inputEvent && event->type() == m_inputType
+            && now - m_inputNs < PropagationNs)
+            break;
+        m_inputNs = now;
+        m_inputType = event->type();
+        m_inputEvent = event;
+        break;
+    }
+    case QEvent::Paint:
+        if (m_paintPendingNs >= 0 && watched == m_feedback) {
+            m_inputToPaint.record(m_clock.nsecsElapsed() - m_paintPendingNs);
+            m_paintPendingNs = -1;
+        }
+        break;
+    default:
+        break;
+    }
+    return QObject::eventFilter(watched, event);
+}
@@ -0,0 +1,141 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * latencyprobe.h
+ *
+ * This file declares the LatencyProbe class for the Simon game.
+ * The LatencyProbe measures how long a press takes from the input event to
+ * the feedback on screen. Installed as an event filter on the application,
+ * it timestamps every mouse, key and touch event before any widget sees
+ * it. The Model marks the entry and exit of each press it validates as it
+ * arrives (rejected and queued presses are left out), and the probe
+ * notes the next paint of the feedback widget (the progress bar). Three
+ * LatencyHistograms collect the samples:
+ *  - input to press: from the input event to the Model taking the press,
+ *  - press: the time the Model spends checking the press,
+ *  - input to paint: from the input event to the feedback being painted.
+ *
+ * A press that is not painted before the next press (for example a wrong
+ * press, which does not move the progress bar) is counted as unpainted
+ * instead of being measured up to an unrelated later paint.
+ *
+ * Usage:
+ *  - Call setFeedbackWidget() and install the probe with
+ *    QCoreApplication::installEventFilter().
+ *  - Attach it to the Model with Model::setLatencyProbe().
+ *  - Print report() on demand and when the application exits.
+ */
+
+#ifndef LATENCYPROBE_H
+#define LATENCYPROBE_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QPointer>
+#include "latencyhistogram.h"
+
+class LatencyProbe : public QObject {
+    Q_OBJECT
+public:
+    /**
+     * @brief Marks the entry and exit of a press for a probe that may be null.
+     */
+    class PressScope {
+    public:
+        explicit PressScope(LatencyProbe *probe) : m_probe(probe) {
+            if (m_probe)
+                m_probe->markPressEntry();
+        }
+        ~PressScope() {
+            if (m_probe)
+                m_probe->markPressExit();
+        }
+        PressScope(const PressScope &) = delete;
+        PressScope &operator=(const PressScope &) = delete;
+
+    private:
+        LatencyProbe *m_probe;
+    };
+
+    /**
+     * @brief Constructs a probe with empty histograms.
+     * @param parent Optional parent QObject.
+     */
+    explicit LatencyProbe(QObject *parent = nullptr);
+
+    /**
+     * @brief Sets the widget whose next paint after a press ends its sample.
+     * @param widget The feedback widget, e.g. the progress bar.
+     */
+    void setFeedbackWidget(QObject *widget) { m_feedback = widget; }
+
+    /**
+     * @brief Marks that the Model starts handling a press.
+     *
+     * The most recent input event is taken as the one that caused the
+     * press; presses without one (e.g. from tools) are only timed inside
+     * the Model.
+     */
+    void markPressEntry();
+
+    /**
+     * @brief Marks that the Model is done with the press.
+     */
+    void markPressExit();
+
+    /**
+     * @brief Returns the samples from the input event to the press entry.
+     */
+    const LatencyHistogram &inputToPress() const { return m_inputToPress; }
+
+    /**
+     * @brief Returns the samples of the time spent inside the press.
+     */
+    const LatencyHistogram &press() const { return m_press; }
+
+    /**
+     * @brief Returns the samples from the input event to the feedback paint.
+     */
+    const LatencyHistogram &inputToPaint() const { return m_inputToPaint; }
+
+    /**
+     * @brief Returns the number of presses whose feedback was never painted.
+     */
+    quint64 unpainted() const { return m_unpainted; }
+
+    /**
+     * @brief Forgets all samples.
+     */
+    void reset();
+
+    /**
+     * @brief Returns a multi-line report with one summary per histogram.
+     */
+    QString report() const;
+
+protected:
+    /**
+     * @brief Timestamps input events and the feedback widget's paints.
+     * @param watched The object the event is delivered to.
+     * @param event The event; never filtered out.
+     */
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    QElapsedTimer m_clock;        ///< Monotonic time base of all timestamps.
+    QPointer<QObject> m_feedback; ///< The widget whose paint ends a sample.
+    qint64 m_inputNs;             ///< Time of the latest input event, -1 once a press took it.
+    int m_inputType;              ///< Type of the latest input event.
+    const QEvent *m_inputEvent;   ///< Address of the latest input event, only compared.
+    qint64 m_entryNs;             ///< Time the current press entered the Model.
+    qint64 m_paintPendingNs;      ///< Input time of the press awaiting its paint, or -1.
+    quint64 m_unpainted;          ///< Presses replaced before their feedback was painted.
+    LatencyHistogram m_inputToPress; ///< Input event to press entry.
+    LatencyHistogram m_press;        ///< Press entry to press exit.
+    LatencyHistogram m_inputToPaint; ///< Input event to feedback paint.
+};
+
+#endif // LATENCYPROBE_H
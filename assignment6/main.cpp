@@ -17,12 +17,64 @@
 #include "mainwindow.h"
 #include "model.h"
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QShortcut>
+#include "tracer.h"
 
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
+
+    // Let the number of pads be chosen on the command line, e.g. --colors 4.
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption colorsOption("colors", "Number of pad colors, 2 to 16.", "n", "2");
+    parser.addOption(colorsOption);
+    // Measure press latency with --latency; Ctrl+L prints the histograms while playing.
+    QCommandLineOption latencyOption("latency", "Measure the latency from a press to its feedback.");
+    parser.addOption(latencyOption);
+    // Record a Chrome trace of the event loop's work with --trace file.json.
+    QCommandLineOption traceOption("trace", "Write a Chrome trace of model, timer, animation and paint events to file.", "file");
+    parser.addOption(traceOption);
+    // Append every game to a binary replay journal with --journal file.
+    QCommandLineOption journalOption("journal", "Append every game to a binary replay journal.", "file");
+    parser.addOption(journalOption);
+    parser.process(a);
+    const bool measureLatency = parser.isSet(latencyOption);
+    const QString tracePath = parser.value(traceOption);
+    TracePaintFilter paintTrace;
+    if (!tracePath.isEmpty()) {
+        Tracer::setEnabled(true);
+        a.installEventFilter(&paintTrace);
+    }
+
+    LatencyProbe probe;
+    ReplayWriter journal;
+    if (parser.isSet(journalOption) && !journal.open(parser.value(journalOption)))
+        qWarning().noquote() << "Could not open the journal" << parser.value(journalOption);
     Model m; // This is the only place a Model is created.
+    m.setColorCount(parser.value(colorsOption).toInt());
+    if (journal.isOpen())
+        m.setJournal(&journal);
     MainWindow w(&m);
+    if (measureLatency) {
+        // The progress bar repaints as the feedback of a correct press.
+        probe.setFeedbackWidget(w.findChild<QWidget*>("progressBar"));
+        a.installEventFilter(&probe);
+        m.setLatencyProbe(&probe);
+        QShortcut *dump = new QShortcut(QKeySequence("Ctrl+L"), &w);
+        QObject::connect(dump, &QShortcut::activated, &probe, [&probe]() {
+            qInfo().noquote() << probe.report();
+        });
+    }
     w.show();
-    return a.exec();
+    const int result = a.exec();
+    if (measureLatency)
+        qInfo().noquote() << probe.report();
+    if (!tracePath.isEmpty()) {
+        Tracer::setEnabled(false);
+        if (!Tracer::instance().writeChromeJson(tracePath))
+            qWarning().noquote() << "Could not write the trace to" << tracePath;
+    }
+    return result;
 }
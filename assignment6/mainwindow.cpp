@@ -13,41 +13,89 @@
  *
  *  - A background gradient for the central widget.
  *  - Custom styling and hover effects for the start button.
- *  - Drop shadow effects for the buttons.
+ *  - Simon pads that flash by switching between precomputed colors.
+ *  - Cached drop shadows for the buttons, painted by the board.
  *  - A custom styled progress bar.
- *  - Animated repositioning of the red and blue buttons with bounce easing.
+ *  - One pad per color: red and blue from the form, extra pads created on demand.
+ *  - Animated repositioning of the pads with bounce easing.
+ *  - One frame loop for all timing: flashes and pad motion advance on the same frames.
  *
  * Widgets are manually positioned and repositioned on window resize events.
  */
 
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
-#include <QTimer>
 #include <QPushButton>
-#include <QPropertyAnimation>
 #include <QRandomGenerator>
 #include <QWidget>
 #include <QResizeEvent>
-#include <QGraphicsDropShadowEffect>
-#include <cmath> // for std::pow
 #include <QEasingCurve>
 
-MainWindow::MainWindow(Model* model, QWidget *parent)
+namespace {
+
+/**
+ * @brief Label and colors of the pad for each color index.
+ */
+struct PadStyle {
+    const char *name; ///< Text shown on the pad.
+    QRgb color;       ///< Color in the normal state.
+    QRgb flash;       ///< Color while the pad is lit.
+};
+
+const PadStyle padStyles[MaxColors] = {
+    { "Red", 0xffff0000, 0xffffff00 },
+    { "Blue", 0xff0000ff, 0xffffff00 },
+    { "Green", 0xff00a000, 0xffffff00 },
+    { "Yellow", 0xffe6c700, 0xffffffff }, // Yellow pads flash white.
+    { "Orange", 0xffff8c00, 0xffffff00 },
+    { "Purple", 0xff8e44ad, 0xffffff00 },
+    { "Cyan", 0xff00bcd4, 0xffffff00 },
+    { "Magenta", 0xffe91e63, 0xffffff00 },
+    { "Brown", 0xff8d6e63, 0xffffff00 },
+    { "Pink", 0xffff9ecb, 0xffffff00 },
+    { "Teal", 0xff008080, 0xffffff00 },
+    { "Lime", 0xff9ccc65, 0xffffff00 },
+    { "Navy", 0xff1a237e, 0xffffff00 },
+    { "Maroon", 0xff800000, 0xffffff00 },
+    { "Olive", 0xff808000, 0xffffff00 },
+    { "Gray", 0xff808080, 0xffffff00 },
+};
+
+}
+
+MainWindow::MainWindow(Model* model, Clock *clock, QWidget *parent)
     : QMainWindow(parent),
     ui(new Ui::MainWindow),
     m_model(model),
-    m_currentRound(0)
+    m_frames(new FrameDriver(clock ? clock : SystemClock::instance(), this)),
+    m_playback(new PlaybackScheduler(m_frames, this)),
+    m_motion(new PadAnimator(this)),
+    m_input(nullptr),
+    m_loseShown(false)
 {
     ui->setupUi(this);
 
-    // Set a background gradient for the central widget.
-    ui->centralwidget->setStyleSheet(
-        "background: qlineargradient(x1:0, y1:0, x2:0, y2:1, stop:0 #f0f8ff, stop:1 #87cefa);"
-        );
+    // Flashes and pad motion step together on the frame loop, one repaint per frame.
+    m_frames->installAnimationDriver();
+
+    // Set a background gradient for the central widget; the board caches it as a pixmap.
+    ui->centralwidget->setBackgroundGradient(QColor(0xf0, 0xf8, 0xff), QColor(0x87, 0xce, 0xfa));
 
-    // Set the initial button colors.
-    ui->redButton->setStyleSheet("background-color: red;");
-    ui->blueButton->setStyleSheet("background-color: blue;");
+    // Set the pad colors once; flashes switch between precomputed states.
+    ui->redButton->setColor(QColor(padStyles[0].color), QColor(padStyles[0].flash));
+    ui->blueButton->setColor(QColor(padStyles[1].color), QColor(padStyles[1].flash));
+    m_pads = { ui->redButton, ui->blueButton };
+    // Every pad bounces to its new position over one second.
+    m_motion->setDuration(1000);
+    m_motion->setEasingCurve(QEasingCurve::OutBounce);
+    m_motion->addPad(ui->redButton);
+    m_motion->addPad(ui->blueButton);
+    // Pads are pressed on the way down, hit-tested where they are on the board.
+    m_input = new PadInput(ui->centralwidget, this);
+    m_input->addPad(ui->redButton);
+    m_input->addPad(ui->blueButton);
+    // Pads never move onto these widgets.
+    m_obstacles = { ui->progressBar, ui->statusLabel, ui->startButton };
     ui->startButton->setStyleSheet(
         "QPushButton { "
         "   background-color: #3498db; "
@@ -77,53 +125,67 @@ MainWindow::MainWindow(Model* model, QWidget *parent)
         "}"
         );
 
-    // Add drop shadow effects to the buttons for a more dynamic look.
-    QGraphicsDropShadowEffect *shadowStart = new QGraphicsDropShadowEffect(this);
-    shadowStart->setBlurRadius(10);
-    shadowStart->setOffset(3, 3);
-    shadowStart->setColor(QColor(0, 0, 0, 150));
-    ui->startButton->setGraphicsEffect(shadowStart);
-
-    QGraphicsDropShadowEffect *shadowRed = new QGraphicsDropShadowEffect(this);
-    shadowRed->setBlurRadius(10);
-    shadowRed->setOffset(3, 3);
-    shadowRed->setColor(QColor(0, 0, 0, 150));
-    ui->redButton->setGraphicsEffect(shadowRed);
-
-    QGraphicsDropShadowEffect *shadowBlue = new QGraphicsDropShadowEffect(this);
-    shadowBlue->setBlurRadius(10);
-    shadowBlue->setOffset(3, 3);
-    shadowBlue->setColor(QColor(0, 0, 0, 150));
-    ui->blueButton->setGraphicsEffect(shadowBlue);
+    // Add drop shadows to the buttons for a more dynamic look. The board blurs
+    // each button shape once and blits the cached shadow when it repaints.
+    ui->centralwidget->shadowCache().setBlurRadius(10);
+    ui->centralwidget->shadowCache().setOffset(QPoint(3, 3));
+    ui->centralwidget->shadowCache().setColor(QColor(0, 0, 0, 150));
+    ui->centralwidget->addShadowCaster(ui->startButton, 5);
+    ui->centralwidget->addShadowCaster(ui->redButton, 5);
+    ui->centralwidget->addShadowCaster(ui->blueButton, 5);
 
     // Position widgets initially.
     positionWidgets();
 
     // Connect UI button clicks directly to model slots.
     connect(ui->startButton, &QPushButton::clicked, m_model, &Model::startGame);
-    connect(ui->redButton, &QPushButton::clicked, [this]() { m_model->checkIsTrueButton(false); });
-    connect(ui->blueButton, &QPushButton::clicked, [this]() { m_model->checkIsTrueButton(true); });
+    connect(m_input, &PadInput::padPressed, this, [this](int pad, qint64 inputUs) {
+        m_model->press(padColor(pad), inputUs);
+    });
+
+    // Add pads for the colors beyond red and blue, now and whenever the count changes.
+    rebuildPads(m_model->colorCount());
+    connect(m_model, &Model::colorCountChanged, this, &MainWindow::rebuildPads);
 
     // Connect model signals to view slots.
-    connect(m_model, &Model::flashButton, this, &MainWindow::flashButton);
-    connect(m_model, &Model::lose, this, &MainWindow::onLose);
-    connect(m_model, &Model::totalAndCurrentRound, this, &MainWindow::updateProgressBar);
-    connect(m_model, &Model::totalRoundUpdated, this, &MainWindow::totalRound);
-    // When a new round starts, update the current round and animate button movement.
-    connect(m_model, &Model::roundStarted, this, [this](int currentRound) {
-        m_currentRound = currentRound;
-        animateButtonMovement();
+    connect(m_model, &Model::sequenceReady, this, &MainWindow::playRound);
+    // The playback scheduler lights and restores the pads.
+    connect(m_playback, &PlaybackScheduler::flashChanged, this, [this](int button, bool lit) {
+        m_pads.at(button)->setFlashed(lit);
     });
+    // The model accepts input once the whole sequence has been shown.
+    connect(m_playback, &PlaybackScheduler::finished, m_model, &Model::playbackFinished);
+    connect(m_model, &Model::lose, this, &MainWindow::onLose);
+    // A restarted or lost game cancels its playback session at once.
+    connect(m_model, &Model::gameRestarted, m_playback, &PlaybackScheduler::cancel);
+    connect(m_model, &Model::lose, m_playback, &PlaybackScheduler::cancel);
+    // Round, progress and round start arrive together in one delta.
+    connect(m_model, &Model::roundStateChanged, this, &MainWindow::applyRoundState);
 }
 
 MainWindow::~MainWindow() {
+    // Drop the playback session while the pads and the frame driver still exist.
+    m_playback->cancel();
     delete ui;
 }
 
+void MainWindow::applyRoundState(const RoundState &state) {
+    if (state.has(RoundState::RoundField))
+        totalRound(state.round);
+    if (state.has(RoundState::ProgressField))
+        updateProgressBar(state.progress, state.round);
+    // When a new round starts, animate button movement.
+    if (state.has(RoundState::StartedField))
+        animateButtonMovement();
+}
+
 void MainWindow::totalRound(int totalRound) {
     ui->statusLabel->setText(QString("Round: %1").arg(totalRound));
-    // Clear any special styling and ensure transparency.
-    ui->statusLabel->setStyleSheet("background-color: transparent;");
+    // Clear the lose styling and ensure transparency; only re-polish when it was shown.
+    if (m_loseShown) {
+        ui->statusLabel->setStyleSheet("background-color: transparent;");
+        m_loseShown = false;
+    }
 }
 
 void MainWindow::updateProgressBar(int current, int total) {
@@ -133,24 +195,51 @@ void MainWindow::updateProgressBar(int current, int total) {
 void MainWindow::onLose() {
     ui->statusLabel->setText("You Lose!");
     ui->statusLabel->setStyleSheet("font-size: 36px; color: red; font-weight: bold;");
+    m_loseShown = true;
 }
 
-void MainWindow::flashButton(int button, int current, int total) {
-    // Compute base delay using exponential decay: 1000 * (0.9^total)
-    int baseDelay = static_cast<int>(1000 * std::pow(0.9, total));
-    QTimer::singleShot(baseDelay * current, this, [this, button, baseDelay]() {
-        // Determine which button to flash.
-        QPushButton *btn = (button == 0) ? ui->redButton : ui->blueButton;
-        // Change style to simulate a flash.
-        btn->setStyleSheet("background-color: yellow;");
-        // Revert back after half the base delay.
-        QTimer::singleShot(baseDelay / 2, this, [btn, button]() {
-            if (button == 0)
-                btn->setStyleSheet("background-color: red;");
-            else
-                btn->setStyleSheet("background-color: blue;");
-        });
-    });
+void MainWindow::rebuildPads(int colors) {
+    // Pads may be deleted below; make sure none of them is still being flashed.
+    m_playback->cancel();
+
+    // Red and blue come from the form; delete the extra pads the new board does not need.
+    while (m_pads.size() > qMax(colors, MinColors)) {
+        SimonPad *pad = m_pads.takeLast();
+        m_motion->removePad(pad);
+        m_input->removePad(pad);
+        ui->centralwidget->removeShadowCaster(pad);
+        delete pad;
+    }
+
+    // Create the missing pads with the same size as the red one.
+    const int first = m_pads.size();
+    for (int i = first; i < colors; i++) {
+        SimonPad *pad = new SimonPad(ui->centralwidget);
+        pad->resize(ui->redButton->size());
+        pad->setText(padStyles[i].name);
+        pad->setColor(QColor(padStyles[i].color), QColor(padStyles[i].flash));
+        ui->centralwidget->addShadowCaster(pad, 5);
+        m_motion->addPad(pad);
+        m_input->addPad(pad);
+        m_pads.append(pad);
+    }
+
+    // Drop the new pads onto free space around the existing ones.
+    resetPlacement();
+    for (int i = 0; i < first; i++)
+        m_placement.addObstacle(m_pads[i]->geometry());
+    for (int i = first; i < m_pads.size(); i++) {
+        SimonPad *pad = m_pads[i];
+        std::optional<QRect> target = m_placement.place(pad->size(), QRandomGenerator::global());
+        if (target)
+            pad->move(target->topLeft());
+        pad->show();
+    }
+}
+
+void MainWindow::playRound(const PlaybackRound &round) {
+    // The whole round arrives at once; the scheduler's single timer walks it locally.
+    m_playback->play(round);
 }
 
 ///
@@ -198,70 +287,38 @@ void MainWindow::positionWidgets() {
 }
 
 ///
-/// animateButtonMovement() - Animates the Red and Blue buttons to random positions within the central widget,
-///                           ensuring they do not overlap each other or the forbidden widgets (progressBar, statusLabel, startButton).
+/// animateButtonMovement() - Animates every pad to a random position within the central widget,
+///                           ensuring no pad overlaps another pad or the forbidden widgets (progressBar, statusLabel, startButton).
 ///
 void MainWindow::animateButtonMovement() {
-    // Get the available area from the central widget.
-    QRect area = ui->centralwidget->rect();
+    // Rebuild the free-space grid without the pads, which are all about to move.
+    resetPlacement();
+    // Stop the previous move where it is; pads that find no space stay there.
+    m_motion->retarget();
 
-    // Build a list of forbidden areas (widgets that should not be overlapped).
-    QVector<QRect> forbidden;
-    forbidden.append(ui->progressBar->geometry());
-    forbidden.append(ui->statusLabel->geometry());
-    forbidden.append(ui->startButton->geometry());
-
-    // Find a new position for the Red button.
-    QRect redCandidate;
-    int maxAttempts = 100;
-    bool redValid = false;
-    for (int attempt = 0; attempt < maxAttempts && !redValid; attempt++) {
-        int newX = QRandomGenerator::global()->bounded(0, area.width() - ui->redButton->width() + 1);
-        int newY = QRandomGenerator::global()->bounded(0, area.height() - ui->redButton->height() + 1);
-        redCandidate = QRect(newX, newY, ui->redButton->width(), ui->redButton->height());
-        redValid = true;
-        for (const QRect &rect : forbidden) {
-            if (redCandidate.intersects(rect)) {
-                redValid = false;
-                break;
-            }
+    for (SimonPad *pad : std::as_const(m_pads)) {
+        // Draw a position uniformly from the space that is still free.
+        std::optional<QRect> target = m_placement.place(pad->size(), QRandomGenerator::global());
+        if (!target) {
+            // The board is full: leave the pad where it is and keep others off it.
+            m_placement.addObstacle(pad->geometry());
+            continue;
         }
-    }
 
-    // Find a new position for the Blue button.
-    QRect blueCandidate;
-    bool blueValid = false;
-    for (int attempt = 0; attempt < maxAttempts && !blueValid; attempt++) {
-        int newX = QRandomGenerator::global()->bounded(0, area.width() - ui->blueButton->width() + 1);
-        int newY = QRandomGenerator::global()->bounded(0, area.height() - ui->blueButton->height() + 1);
-        blueCandidate = QRect(newX, newY, ui->blueButton->width(), ui->blueButton->height());
-        blueValid = true;
-        for (const QRect &rect : forbidden) {
-            if (blueCandidate.intersects(rect)) {
-                blueValid = false;
-                break;
-            }
-        }
-        // Ensure Blue does not overlap Red.
-        if (blueValid && blueCandidate.intersects(redCandidate))
-            blueValid = false;
+        // Animate the pad to its new position.
+        m_motion->setTarget(pad, target->topLeft());
     }
+    m_motion->start();
+}
 
-    // Animate the Red button to its new position.
-    QPropertyAnimation *animRed = new QPropertyAnimation(ui->redButton, "pos");
-    animRed->setDuration(1000); // 1 second duration
-    animRed->setStartValue(ui->redButton->pos());
-    animRed->setEndValue(redCandidate.topLeft());
-    animRed->setEasingCurve(QEasingCurve::OutBounce);
-    animRed->start(QAbstractAnimation::DeleteWhenStopped);
-
-    // Animate the Blue button to its new position.
-    QPropertyAnimation *animBlue = new QPropertyAnimation(ui->blueButton, "pos");
-    animBlue->setDuration(1000);
-    animBlue->setStartValue(ui->blueButton->pos());
-    animBlue->setEndValue(blueCandidate.topLeft());
-    animBlue->setEasingCurve(QEasingCurve::OutBounce);
-    animBlue->start(QAbstractAnimation::DeleteWhenStopped);
+///
+/// resetPlacement() - Rebuilds the free-space grid over the central widget and marks
+///                    the forbidden widgets (progressBar, statusLabel, startButton).
+///
+void MainWindow::resetPlacement() {
+    m_placement.reset(ui->centralwidget->rect());
+    for (QWidget *obstacle : std::as_const(m_obstacles))
+        m_placement.addObstacle(obstacle->geometry());
 }
 
 //
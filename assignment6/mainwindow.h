@@ -14,7 +14,9 @@
  * Features:
  *  - Displays the current round and player's progress.
  *  - Flashes the Simon game buttons based on the game sequence.
- *  - Animates the red and blue buttons to random positions.
+ *  - Shows one pad per color of the game (red and blue, plus up to 14 more).
+ *  - Animates the pads to random positions.
+ *  - Takes pad presses on mouse, touch or key down (keys 1-9, 0, Q-Y).
  *  - Shows a prominent "You Lose!" message when the player makes a mistake.
  *
  * Usage:
@@ -28,7 +30,14 @@
 #define MAINWINDOW_H
 
 #include <QMainWindow>
+#include <QVector>
+#include "framedriver.h"
 #include "model.h"
+#include "padanimator.h"
+#include "padinput.h"
+#include "placementengine.h"
+#include "playbackscheduler.h"
+#include "simonpad.h"
 
 QT_BEGIN_NAMESPACE
 namespace Ui { class MainWindow; }
@@ -41,9 +50,10 @@ public:
     /**
      * @brief Constructs the MainWindow.
      * @param model Pointer to the game Model; used for connecting signals and slots.
+     * @param clock Clock the frame loop runs on; nullptr for the system clock.
      * @param parent Optional parent widget.
      */
-    explicit MainWindow(Model* model, QWidget *parent = nullptr);
+    explicit MainWindow(Model* model, Clock *clock = nullptr, QWidget *parent = nullptr);
 
     /**
      * @brief Destructor for MainWindow.
@@ -51,6 +61,16 @@ public:
     ~MainWindow();
 
 public slots:
+    /**
+     * @brief Applies a round state delta from the model in a single pass.
+     *
+     * Updates the status label, the progress bar and the pad animation
+     * for whichever fields changed.
+     *
+     * @param state The round state delta.
+     */
+    void applyRoundState(const RoundState &state);
+
     /**
      * @brief Updates the status label with the total round count.
      * @param totalRound The total round number.
@@ -70,19 +90,24 @@ public slots:
     void onLose();
 
     /**
-     * @brief Flashes a button given its identifier, sequence index, and total moves.
-     * @param button Identifier of the button (0 for red, 1 for blue).
-     * @param current The index of the current flash in the sequence.
-     * @param total The total number of moves in the sequence.
+     * @brief Plays a round published by the model on the playback scheduler.
+     * @param round The moves of the round and the tempo to play them at.
      */
-    void flashButton(int button, int current, int total);
+    void playRound(const PlaybackRound &round);
 
     /**
-     * @brief Animates the red and blue buttons to random positions.
+     * @brief Shows one pad per color, creating or deleting pads beyond red and blue.
+     * @param colors The number of colors of the game.
+     */
+    void rebuildPads(int colors);
+
+    /**
+     * @brief Animates the pads to random positions.
      *
-     * This function moves the red and blue buttons to new random positions
-     * within the central widget while ensuring they do not overlap with the
-     * Start button, status label, or progress bar.
+     * This function moves every pad to a new random position within the
+     * central widget, drawn uniformly from the space not covered by the
+     * Start button, status label, progress bar, or another pad. A move
+     * still in flight is redirected from the pads' current positions.
      */
     void animateButtonMovement();
 
@@ -102,9 +127,21 @@ private:
      */
     void positionWidgets();
 
+    /**
+     * @brief Clears the placement grid and marks the widgets pads must avoid.
+     */
+    void resetPlacement();
+
     Ui::MainWindow *ui;  ///< Pointer to the UI form generated by Qt Designer.
     Model *m_model;      ///< Pointer to the game model.
-    int m_currentRound;  ///< Stores the current round (used for delay calculations and animations).
+    FrameDriver *m_frames;         ///< The frame loop driving playback and pad animations.
+    PlaybackScheduler *m_playback; ///< Plays the sequence back on the frames.
+    QVector<SimonPad*> m_pads; ///< The pads indexed by color (0 for red, 1 for blue, ...).
+    PadAnimator *m_motion;         ///< Moves all pads with one reusable animation group.
+    PadInput *m_input;             ///< Presses the pads on mouse, touch or key down.
+    QVector<QWidget*> m_obstacles; ///< Widgets the pads must not move onto.
+    PlacementEngine m_placement;   ///< Free-space grid used to place the pads.
+    bool m_loseShown;    ///< True while the status label shows the lose message and its styling.
 };
 
 #endif // MAINWINDOW_H
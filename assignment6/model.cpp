@@ -7,88 +7,270 @@
  * model.cpp
  *
  * This file implements the Model class for the Simon game.
- * The Model class manages the game state, including the current round,
- * the sequence of moves, and validating player input.
+ * The Model class forwards player input to SimonCore, which owns the game
+ * state (the current round, the sequence of moves) and the rules.
  * It emits signals to update the view with game events such as:
- *  - Total round count updates.
- *  - Flashing buttons according to the game sequence.
- *  - Player progress updates.
- *  - Initiation of a new round.
+ *  - Round state deltas covering the round count, player progress and the
+ *    initiation of a new round in a single emission.
+ *  - Publishing the game sequence and its tempo once per round.
  *  - Notification when the player loses.
  *
  * All game logic is handled in this class, while the view listens to its signals
- * to update the UI accordingly.
+ * to update the UI accordingly. Round transitions are posted to the event
+ * loop, so no signal handler ever runs the next round from inside a press.
  */
 
 #include "model.h"
-#include <cstdlib>
-#include <ctime>
-#include <QTimer>
+#include "tracer.h"
+#include <QRandomGenerator>
 
 Model::Model(QObject *parent)
     : QObject(parent),
-    m_currentRound(0),
-    m_userIndex(0)
+    m_core(QRandomGenerator::global()->generate64()),
+    m_seedPinned(false),
+    m_stateVersion(0),
+    m_phase(Phase::Idle),
+    m_inputPolicy(InputPolicy::Reject),
+    m_transitionToken(0),
+    m_latencyProbe(nullptr),
+    m_journal(nullptr)
 {
-    // Seed the random generator to ensure a different sequence for each game.
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+}
+
+void Model::setInputPolicy(InputPolicy policy) {
+    m_inputPolicy = policy;
+    if (policy == InputPolicy::Reject)
+        m_queuedPresses.clear();
+}
+
+void Model::setPhase(Phase phase) {
+    if (phase == m_phase)
+        return;
+    m_phase = phase;
+    Tracer::Scope trace("Model::phaseChanged", "signal");
+    emit phaseChanged(phase);
+}
+
+void Model::setColorCount(int colors) {
+    Tracer::Scope trace("Model::setColorCount", "model");
+    // The core abandons the game in progress when the count changes.
+    if (m_core.setColorCount(colors)) {
+        m_transitionToken++;
+        m_queuedPresses.clear();
+        setPhase(Phase::Idle);
+        {
+            Tracer::Scope restartTrace("Model::gameRestarted", "signal");
+            emit gameRestarted();
+        }
+        Tracer::Scope emitTrace("Model::colorCountChanged", "signal");
+        emit colorCountChanged(m_core.colorCount());
+    }
+}
+
+void Model::setSeed(quint64 seed) {
+    // Moves packed for the old seed no longer match; the core rebuilds them.
+    m_core.reseed(seed);
+    m_seedPinned = true;
+}
+
+void Model::setSequenceMode(SequenceMode mode) {
+    if (mode == sequenceMode())
+        return;
+    // Both modes derive moves from the seed, so switching to Stored just packs them.
+    m_core.storage().setMode(mode);
+    m_core.repack();
 }
 
 void Model::startGame() {
+    Tracer::Scope trace("Model::startGame", "model");
+    // Draw a fresh seed for each game unless one was pinned for replays.
+    quint64 seed = m_seedPinned ? m_core.seed() : QRandomGenerator::global()->generate64();
     // Reset game state: round, sequence, and user progress.
-    m_currentRound = 0;
-    m_sequence.clear();
-    m_userIndex = 0;
-    // Begin the first round.
-    addRound();
+    m_core.reset(seed);
+    m_queuedPresses.clear();
+    // Anything still playing belongs to the old game.
+    {
+        Tracer::Scope emitTrace("Model::gameRestarted", "signal");
+        emit gameRestarted();
+    }
+    // Draw the first round now and publish it from the event loop.
+    m_core.advanceRound();
+    if (m_journal) {
+        m_journal->gameStarted(m_core.colorCount(), seed);
+        m_journal->roundStarted(m_core.round());
+    }
+    scheduleRoundStart();
 }
 
 void Model::addRound() {
-    // Increment the round counter.
-    m_currentRound++;
-    // Reset user progress for the new round.
-    m_userIndex = 0;
-    // Append a new random move to the sequence.
-    addRandomMove();
-
-    // Emit signals to update the view with new round information.
-    emit totalRoundUpdated(m_currentRound);
-    emit totalAndCurrentRound(m_userIndex, m_currentRound);
-    emit roundStarted(m_currentRound);
-
-    // Play the current sequence by emitting flash signals.
+    Tracer::Scope trace("Model::addRound", "model");
+    m_core.advanceRound();
+    if (m_journal)
+        m_journal->roundStarted(m_core.round());
+    // A posted transition would publish a round that is already out of date.
+    m_transitionToken++;
+    publishRoundStart();
+}
+
+void Model::scheduleRoundStart() {
+    setPhase(Phase::Transition);
+    const quint64 token = ++m_transitionToken;
+    // Let the current call unwind first; a restart or a loss in between bumps the token.
+    QMetaObject::invokeMethod(this, [this, token]() {
+        Tracer::Scope trace("Model::roundStart", "model");
+        if (token == m_transitionToken && m_phase == Phase::Transition)
+            publishRoundStart();
+    }, Qt::QueuedConnection);
+}
+
+void Model::publishRoundStart() {
+    // Emit one delta with the new round, the reset progress and the round start.
+    publishState(RoundState::RoundField | RoundState::ProgressField | RoundState::StartedField);
+
+    // Publish the current sequence for playback.
     playSequence();
 }
 
-void Model::addRandomMove() {
-    // Generate a random move: 0 (Red) or 1 (Blue) and add it to the sequence.
-    int move = std::rand() % 2;
-    m_sequence.append(move);
+void Model::publishState(int changed) {
+    RoundState state;
+    state.version = ++m_stateVersion;
+    state.changed = changed;
+    state.round = m_core.round();
+    state.progress = m_core.userIndex();
+    Tracer::Scope trace("Model::roundStateChanged", "signal");
+    emit roundStateChanged(state);
 }
 
 void Model::playSequence() {
-    // Iterate over the sequence and emit a flash signal for each move.
-    for (int i = 0; i < m_sequence.size(); i++) {
-        emit flashButton(m_sequence.at(i), i, m_currentRound);
+    Tracer::Scope trace("Model::playSequence", "model");
+    // Input waits until the view has shown the sequence.
+    if (m_phase != Phase::Idle && m_phase != Phase::Lost)
+        setPhase(Phase::Playback);
+    // Publish the whole round at once; the packed words are shared, not copied,
+    // and seeded rounds carry only the seed and length.
+    Tracer::Scope emitTrace("Model::sequenceReady", "signal");
+    emit sequenceReady(m_core.playbackRound());
+}
+
+void Model::playbackFinished() {
+    Tracer::Scope trace("Model::playbackFinished", "model");
+    if (m_phase != Phase::Playback)
+        return;
+    setPhase(Phase::AwaitInput);
+    // Replay presses that arrived during playback until one ends the round or the game.
+    while (!m_queuedPresses.isEmpty() && m_phase == Phase::AwaitInput) {
+        const QueuedPress queued = m_queuedPresses.dequeue();
+        validatePress(queued.color, queued.inputUs);
     }
 }
 
 void Model::checkIsTrueButton(bool isBlue) {
-    // Convert the boolean input to a button identifier:
-    // false -> 0 (Red), true -> 1 (Blue).
-    int button = isBlue ? 1 : 0;
-
-    // Check if the user's press matches the current move in the sequence.
-    if (m_userIndex < m_sequence.size() && m_sequence[m_userIndex] == button) {
-        // Correct move: increment the user progress.
-        m_userIndex++;
-        emit totalAndCurrentRound(m_userIndex, m_currentRound);
-        // If the player has completed the sequence, start a new round.
-        if (m_userIndex == m_sequence.size()) {
-            addRound();
-        }
-    } else {
+    Tracer::Scope trace("Model::checkIsTrueButton", "model");
+    // Convert the boolean input to a pad of the two-color game:
+    // false -> Red, true -> Blue.
+    press(isBlue ? PadColor::Blue : PadColor::Red);
+}
+
+void Model::press(PadColor color, qint64 inputUs) {
+    Tracer::Scope trace("Model::press", "model");
+    switch (m_phase) {
+    case Phase::Playback:
+    case Phase::Transition:
+        // The player has not seen the sequence yet.
+        if (m_inputPolicy == InputPolicy::Queue)
+            m_queuedPresses.enqueue({color, inputUs});
+        return;
+    case Phase::Lost:
+        return;
+    case Phase::Idle:
+    case Phase::AwaitInput: {
+        // Time only presses checked as they arrive, if latency is being measured;
+        // rejected and queued presses never reach the feedback.
+        LatencyProbe::PressScope timing(m_latencyProbe);
+        validatePress(color, inputUs);
+        return;
+    }
+    }
+}
+
+void Model::validatePress(PadColor color, qint64 inputUs) {
+    // Only presses of a started game belong in the journal, stamped with the time of the input.
+    ReplayWriter *journal = m_phase != Phase::Idle ? m_journal : nullptr;
+    if (journal)
+        journal->pressed(padIndex(color), inputUs);
+    switch (m_core.press(padIndex(color))) {
+    case PressOutcome::Progress:
+        publishState(RoundState::ProgressField);
+        break;
+    case PressOutcome::RoundComplete:
+        if (journal)
+            journal->roundStarted(m_core.round(), inputUs);
+        // The core already drew the next round; its delta also carries the progress.
+        scheduleRoundStart();
+        break;
+    case PressOutcome::Wrong:
+        if (journal)
+            journal->lost(inputUs);
         // Incorrect move: notify the view that the player lost.
-        emit lose();
+        enterLost();
+        break;
+    }
+}
+
+void Model::enterLost() {
+    m_transitionToken++;
+    m_queuedPresses.clear();
+    setPhase(Phase::Lost);
+    Tracer::Scope trace("Model::lose", "signal");
+    emit lose();
+}
+
+PressBatchResult Model::checkPresses(MoveSequenceView presses, const qint64 *inputUs) {
+    Tracer::Scope trace("Model::checkPresses", "model");
+    if (m_phase != Phase::AwaitInput) {
+        // Nothing is validated outside AwaitInput, and batches are never queued.
+        PressBatchResult rejected;
+        rejected.round = m_core.round();
+        rejected.progress = m_core.userIndex();
+        return rejected;
+    }
+
+    const int roundBefore = m_core.round();
+    const int userIndexBefore = m_core.userIndex();
+    PressBatchResult result = m_core.pressBatch(presses);
+
+    if (m_journal) {
+        // Record the burst as validatePress would have, one press at a time:
+        // round r takes r presses, so every round boundary falls at a known press.
+        int round = roundBefore;
+        int index = userIndexBefore;
+        for (qsizetype i = 0; i < result.accepted; i++) {
+            const qint64 timeUs = inputUs ? inputUs[i] : -1;
+            m_journal->pressed(presses.at(i), timeUs);
+            if (++index == round) {
+                index = 0;
+                m_journal->roundStarted(++round, timeUs);
+            }
+        }
+        // A wrong press ends the game; nothing follows it.
+        if (result.lost()) {
+            const qint64 timeUs = inputUs ? inputUs[result.mismatchIndex] : -1;
+            m_journal->pressed(presses.at(result.mismatchIndex), timeUs);
+            m_journal->lost(timeUs);
+        }
+    }
+
+    // Tell the view about the outcome of the whole burst at once.
+    if (result.lost()) {
+        if (result.roundsCompleted > 0)
+            publishState(RoundState::RoundField | RoundState::ProgressField);
+        else if (result.progress != userIndexBefore)
+            publishState(RoundState::ProgressField);
+        enterLost();
+    } else if (result.roundsCompleted > 0) {
+        scheduleRoundStart();
+    } else if (result.progress != userIndexBefore) {
+        publishState(RoundState::ProgressField);
     }
+    return result;
 }
@@ -7,29 +7,80 @@
  * model.h
  *
  * This file declares the Model class for the Simon game.
- * The Model class is responsible for managing the game state, including
- * the current round, the sequence of moves, and validating player input.
- * It emits signals to update the view with game events such as:
- *  - Total round count updates.
- *  - Flashing buttons for the sequence.
- *  - Player progress in the current round.
- *  - When a new round starts.
+ * The Model class is the Qt adapter over SimonCore, which holds the game
+ * state (the current round, the sequence of moves) and validates player
+ * input. The Model turns the core's results into signals to update the view with game events such as:
+ *  - Round state deltas: the round count, the player's progress and the
+ *    start of a new round, coalesced into one versioned RoundState.
+ *  - The sequence to play back each round, published once per round.
  *  - When the player loses.
  *
+ * A game has between 2 and 16 colors (two by default, four for the classic
+ * variant). Moves are color indices packed at ceil(log2(colors)) bits.
+ *
+ * Moves are drawn from a counter-based generator, so move i of a game is a
+ * pure function of the game's seed and i. In Stored mode the moves are also
+ * kept bit-packed; in Seeded mode only the seed and the round count are kept
+ * and every move is recomputed on demand.
+ *
+ * A game moves through explicit phases: Idle -> Transition -> Playback ->
+ * AwaitInput -> Transition -> ... and Lost on a wrong press. A transition
+ * never runs inside the call that caused it: the press that completes a
+ * round returns first, and the next round is published from a posted event.
+ * While the sequence plays back, presses are rejected or queued until the
+ * view reports the end of the playback with playbackFinished().
+ *
  * Usage:
  *  - Construct the Model as a QObject.
- *  - The view (e.g., MainWindow) connects to the Model's signals to update the UI.
+ *  - Optionally pin a seed with setSeed() to replay a game exactly.
+ *  - The view (e.g., MainWindow) connects to the Model's signals to update the UI
+ *    and calls playbackFinished() when it has shown the sequence.
  */
 
 #ifndef MODEL_H
 #define MODEL_H
 
 #include <QObject>
-#include <QVector>
+#include <QQueue>
+#include "latencyprobe.h"
+#include "movesequence.h"
+#include "padcolor.h"
+#include "playbackround.h"
+#include "pressbatchresult.h"
+#include "replaywriter.h"
+#include "roundstate.h"
+#include "simoncore.h"
 
 class Model : public QObject {
     Q_OBJECT
 public:
+    /// How the sequence of moves is kept in memory.
+    using SequenceMode = ::SequenceMode;
+
+    /// The rules the Model wraps: colors and storage are chosen at run time.
+    using Core = SimonCore<DynamicColors, SwitchableStorage>;
+
+    /**
+     * @brief The phase of the game.
+     */
+    enum class Phase {
+        Idle,       ///< No game has been started.
+        Playback,   ///< The view is playing the sequence back.
+        AwaitInput, ///< The player is repeating the sequence.
+        Transition, ///< A round was drawn; it is published on the next pass of the event loop.
+        Lost        ///< The player pressed a wrong pad.
+    };
+    Q_ENUM(Phase)
+
+    /**
+     * @brief What happens to presses that arrive while the sequence is not accepting input.
+     */
+    enum class InputPolicy {
+        Reject, ///< Presses during Playback and Transition are dropped.
+        Queue   ///< Presses are kept and validated once input is awaited.
+    };
+    Q_ENUM(InputPolicy)
+
     /**
      * @brief Constructs a new Model object.
      * @param parent Optional parent QObject.
@@ -40,13 +91,135 @@ public:
      * @brief Returns the current round number.
      * @return The current round.
      */
-    int currentRound() const { return m_currentRound; }
+    int currentRound() const { return m_core.round(); }
+
+    /**
+     * @brief Returns the index of the next move the player needs to match.
+     */
+    int userIndex() const { return m_core.userIndex(); }
+
+    /**
+     * @brief Returns a non-owning view of the sequence of moves.
+     *
+     * The view does not copy the sequence; it is invalidated by the next
+     * round or by restarting the game. It is empty in Seeded mode; use
+     * moveAt() to read moves in either mode.
+     *
+     * @return A MoveSequenceView over the sequence of color indices.
+     */
+    MoveSequenceView sequence() const { return m_core.sequence(); }
+
+    /**
+     * @brief Returns the number of moves in the sequence.
+     */
+    int sequenceLength() const { return m_core.round(); }
+
+    /**
+     * @brief Returns the move at the given index of the sequence.
+     * @param index Index of the move; must be in [0, sequenceLength()).
+     * @return The color index of the move, in [0, colorCount()).
+     */
+    int moveAt(int index) const { return m_core.moveAt(index); }
+
+    /**
+     * @brief Returns the number of colors in the game.
+     */
+    int colorCount() const { return m_core.colorCount(); }
+
+    /**
+     * @brief Sets the number of colors and abandons the game in progress.
+     *
+     * Emits colorCountChanged() if the count changes; the next startGame()
+     * plays with the new colors.
+     *
+     * @param colors Number of colors, clamped to [MinColors, MaxColors].
+     */
+    void setColorCount(int colors);
+
+    /**
+     * @brief Returns the seed of the current game.
+     */
+    quint64 seed() const { return m_core.seed(); }
+
+    /**
+     * @brief Pins the seed used by this and every following game.
+     *
+     * Without a pinned seed, each startGame() draws a fresh seed.
+     *
+     * @param seed The seed to generate moves from.
+     */
+    void setSeed(quint64 seed);
+
+    /**
+     * @brief Returns how the sequence is kept in memory.
+     */
+    SequenceMode sequenceMode() const { return m_core.storage().mode(); }
+
+    /**
+     * @brief Switches how the sequence is kept in memory.
+     *
+     * Both modes produce the same moves for a seed, so the mode can be
+     * switched at any time; switching to Stored packs the current moves.
+     *
+     * @param mode The new sequence mode.
+     */
+    void setSequenceMode(SequenceMode mode);
+
+    /**
+     * @brief Returns the phase of the game.
+     */
+    Phase phase() const { return m_phase; }
 
     /**
-     * @brief Returns the sequence of moves.
-     * @return A QVector<int> containing the sequence (0 for Red, 1 for Blue).
+     * @brief Returns what happens to presses during Playback and Transition.
      */
-    QVector<int> sequence() const { return m_sequence; }
+    InputPolicy inputPolicy() const { return m_inputPolicy; }
+
+    /**
+     * @brief Sets what happens to presses during Playback and Transition.
+     * @param policy Reject (the default) or Queue.
+     */
+    void setInputPolicy(InputPolicy policy);
+
+    /**
+     * @brief Attaches a probe that times every press validated as it arrives; nullptr (the default) detaches it.
+     * @param probe The probe; must outlive the Model or be detached first.
+     */
+    void setLatencyProbe(LatencyProbe *probe) { m_latencyProbe = probe; }
+
+    /**
+     * @brief Attaches a journal that records every game; nullptr (the default) detaches it.
+     *
+     * The journal gets each game's colors and seed, every validated press,
+     * every round boundary and the loss, enough to replay the game exactly.
+     *
+     * @param journal The journal; must outlive the Model or be detached first.
+     */
+    void setJournal(ReplayWriter *journal) { m_journal = journal; }
+
+    /**
+     * @brief Returns the rules the Model wraps, for read-only use.
+     */
+    const Core &core() const { return m_core; }
+
+    /**
+     * @brief Validates a burst of presses at once.
+     *
+     * The presses are compared with the sequence a word at a time. Presses that
+     * complete a round carry on into the next one without waiting for its
+     * playback, and the view only gets one RoundState delta and, if rounds
+     * were completed, one transition to the final round. lose() is emitted
+     * if a press is wrong; presses after it are ignored.
+     *
+     * Batches are only accepted in the AwaitInput phase and are never
+     * queued; in any other phase nothing is validated (accepted is 0 and
+     * the result is not lost).
+     *
+     * @param presses The presses as color indices, packed with the same bits per move as the sequence.
+     * @param inputUs Time of each press's input event, from SystemClock::nowUs(), for the journal; null for now.
+     * @return How many presses matched, the first mismatch and the rounds completed.
+     */
+    PressBatchResult checkPresses(MoveSequenceView presses, const qint64 *inputUs = nullptr);
 
 public slots:
     /**
@@ -55,7 +228,10 @@ public slots:
     void startGame();
 
     /**
-     * @brief Adds a new round, updates the sequence, and emits signals for the view.
+     * @brief Adds a new round and publishes it immediately, without a transition.
+     *
+     * Used by tools and benchmarks; the game itself moves between rounds
+     * through asynchronous transitions.
      */
     void addRound();
 
@@ -65,6 +241,34 @@ public slots:
      */
     void checkIsTrueButton(bool isBlue);
 
+    /**
+     * @brief Checks if the player's press of a pad is correct.
+     *
+     * A correct press advances the player's progress and, at the end of the
+     * sequence, schedules the transition to the next round; a wrong press
+     * emits lose(). Presses during Playback and Transition follow the input
+     * policy, and presses after a loss are ignored.
+     *
+     * @param color The pad the player pressed.
+     * @param inputUs Time of the input event, from SystemClock::nowUs(), for the journal; -1 for now.
+     */
+    void press(PadColor color, qint64 inputUs = -1);
+
+    /**
+     * @brief Publishes the sequence and its tempo to the view with a single sequenceReady signal.
+     *
+     * Called when a round starts; can also be called to play the current round
+     * again. Enters the Playback phase while a game is running.
+     */
+    void playSequence();
+
+    /**
+     * @brief Tells the Model that the view has finished playing the sequence back.
+     *
+     * Moves from Playback to AwaitInput and validates any queued presses.
+     */
+    void playbackFinished();
+
 signals:
     /**
      * @brief Emitted when the player makes an incorrect move.
@@ -72,46 +276,91 @@ signals:
     void lose();
 
     /**
-     * @brief Emitted to update the view with the total round count.
-     * @param totalRounds The total number of rounds.
+     * @brief Emitted once per round with the whole sequence the view should play back.
+     * @param round Shared snapshot of the sequence plus the tempo of the round.
+     */
+    void sequenceReady(const PlaybackRound &round);
+
+    /**
+     * @brief Emitted once per change of the round or the player's progress.
+     *
+     * A new round emits a single delta with the round, the reset progress
+     * and the start of the round; a correct press emits the new progress.
+     *
+     * @param state The current state and the fields that changed.
      */
-    void totalRoundUpdated(int totalRounds);
+    void roundStateChanged(const RoundState &state);
 
     /**
-     * @brief Emitted to notify the view that a button should flash.
-     * @param button Identifier of the button (0 for Red, 1 for Blue).
-     * @param current The current index in the sequence being flashed.
-     * @param total The total number of moves in the sequence.
+     * @brief Emitted whenever the phase of the game changes.
+     * @param phase The new phase.
      */
-    void flashButton(int button, int current, int total);
+    void phaseChanged(Model::Phase phase);
 
     /**
-     * @brief Emitted to update the view with the player's current progress.
-     * @param current The number of moves the player has correctly matched.
-     * @param total The total number of moves in the current round.
+     * @brief Emitted when the game in progress is abandoned by startGame() or setColorCount().
+     *
+     * The view cancels any playback of the old game; the new game's rounds follow.
      */
-    void totalAndCurrentRound(int current, int total);
+    void gameRestarted();
 
     /**
-     * @brief Emitted when a new round starts.
-     * @param currentRound The current round number.
+     * @brief Emitted when the number of colors changes, so the view can rebuild its pads.
+     * @param colors The new number of colors.
      */
-    void roundStarted(int currentRound);
+    void colorCountChanged(int colors);
 
 private:
-    int m_currentRound;     ///< The current round number.
-    QVector<int> m_sequence;    ///< The sequence of moves (0 for Red, 1 for Blue).
-    int m_userIndex;        ///< The index of the next move the player needs to match.
+    /**
+     * @brief A press kept under InputPolicy::Queue, with the time of its input.
+     */
+    struct QueuedPress {
+        PadColor color; ///< The pad pressed.
+        qint64 inputUs; ///< Time of the input event, or -1.
+    };
+
+    Core m_core;            ///< The game state and rules.
+    bool m_seedPinned;      ///< True if setSeed() fixed the seed for every game.
+    quint64 m_stateVersion; ///< Version of the last emitted RoundState.
+    Phase m_phase;          ///< The phase of the game.
+    InputPolicy m_inputPolicy; ///< What happens to presses outside AwaitInput.
+    quint64 m_transitionToken; ///< Bumped to invalidate a posted transition.
+    QQueue<QueuedPress> m_queuedPresses; ///< Presses waiting for AwaitInput under InputPolicy::Queue.
+    LatencyProbe *m_latencyProbe;     ///< Times each press when set; null unless measuring.
+    ReplayWriter *m_journal;          ///< Records the games when set; null unless journaling.
 
     /**
-     * @brief Adds a random move (0 or 1) to the sequence.
+     * @brief Emits a RoundState delta with the given changed fields.
+     * @param changed Bit mask of RoundState::Field values.
      */
-    void addRandomMove();
+    void publishState(int changed);
 
     /**
-     * @brief Plays the sequence by iterating over m_sequence and emitting flashButton signals.
+     * @brief Tells the view a new round started: one RoundState delta, then the playback.
      */
-    void playSequence();
+    void publishRoundStart();
+
+    /**
+     * @brief Enters Transition and posts the publication of the round the core just drew.
+     */
+    void scheduleRoundStart();
+
+    /**
+     * @brief Validates one press in the AwaitInput (or Idle) phase.
+     * @param color The pad pressed.
+     * @param inputUs Time of the input event, or -1 for now.
+     */
+    void validatePress(PadColor color, qint64 inputUs);
+
+    /**
+     * @brief Enters the Lost phase, drops queued input and emits lose().
+     */
+    void enterLost();
+
+    /**
+     * @brief Changes the phase and emits phaseChanged() if it differs.
+     */
+    void setPhase(Phase phase);
 };
 
 #endif // MODEL_H
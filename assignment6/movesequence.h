@@ -0,0 +1,214 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * movesequence.h
+ *
+ * This file declares the MoveSequence container and its non-owning
+ * MoveSequenceView used by the Model to store the Simon sequence.
+ * Every move is stored in ceil(log2(colors)) bits inside 64-bit words: one
+ * bit per move for the classic two-color game (0 for Red, 1 for Blue), two
+ * for the four-pad variant and at most four for sixteen colors. A sequence
+ * of a million two-color moves only needs about 122 KiB instead of 4 MiB
+ * of ints.
+ *
+ * Usage:
+ *  - The Model appends moves with append() and reads them with at().
+ *  - packedAt() reads as many consecutive moves as fit in one word, so two
+ *    sequences can be compared a word at a time.
+ *  - Readers that only need to look at the moves take a MoveSequenceView,
+ *    which never copies the underlying storage.
+ */
+
+#ifndef MOVESEQUENCE_H
+#define MOVESEQUENCE_H
+
+#include <QtGlobal>
+#include <QVector>
+
+/**
+ * @brief A read-only, non-owning view over a packed move sequence.
+ *
+ * The view stays valid only as long as the MoveSequence it was taken from
+ * is not modified or destroyed.
+ */
+class MoveSequenceView {
+public:
+    MoveSequenceView() = default;
+
+    /**
+     * @brief Constructs a view over packed words.
+     * @param words Pointer to the first 64-bit word of packed moves.
+     * @param size Number of moves in the view.
+     * @param bitsPerMove Number of bits each move takes, in [1, 4].
+     */
+    MoveSequenceView(const quint64 *words, qsizetype size, int bitsPerMove = 1)
+        : m_words(words), m_size(size), m_bitsPerMove(bitsPerMove) {}
+
+    /**
+     * @brief Returns the number of moves in the view.
+     */
+    qsizetype size() const { return m_size; }
+
+    /**
+     * @brief Returns true if the view holds no moves.
+     */
+    bool isEmpty() const { return m_size == 0; }
+
+    /**
+     * @brief Returns the number of bits each move takes.
+     */
+    int bitsPerMove() const { return m_bitsPerMove; }
+
+    /**
+     * @brief Returns how many moves packedAt() can read at once.
+     */
+    int movesPerWord() const { return 64 / m_bitsPerMove; }
+
+    /**
+     * @brief Returns the move at the given index.
+     * @param i Index of the move; must be in [0, size()).
+     * @return The color index of the move (0 for Red, 1 for Blue, ...).
+     */
+    int at(qsizetype i) const {
+        Q_ASSERT(i >= 0 && i < m_size);
+        return static_cast<int>(packedAt(i, 1));
+    }
+
+    int operator[](qsizetype i) const { return at(i); }
+
+    /**
+     * @brief Returns consecutive moves packed into one word.
+     * @param index Index of the first move.
+     * @param count Number of moves to read, in [0, movesPerWord()]; index + count must not exceed size().
+     * @return The moves, move index in the lowest bits; bits above the last move are zero.
+     */
+    quint64 packedAt(qsizetype index, int count) const {
+        Q_ASSERT(count >= 0 && count <= movesPerWord() && index >= 0 && index + count <= m_size);
+        const int bits = count * m_bitsPerMove;
+        if (bits == 0)
+            return 0;
+        const qsizetype offset = index * m_bitsPerMove;
+        const qsizetype word = offset >> 6;
+        const int shift = static_cast<int>(offset & 63);
+        quint64 packed = m_words[word] >> shift;
+        // The moves straddle two words.
+        if (shift != 0 && shift + bits > 64)
+            packed |= m_words[word + 1] << (64 - shift);
+        return bits == 64 ? packed : packed & ((quint64(1) << bits) - 1);
+    }
+
+    /**
+     * @brief Returns a pointer to the packed words backing the view.
+     */
+    const quint64 *words() const { return m_words; }
+
+private:
+    const quint64 *m_words = nullptr; ///< Packed moves, move i at bit i * m_bitsPerMove.
+    qsizetype m_size = 0;             ///< Number of valid moves.
+    int m_bitsPerMove = 1;            ///< Number of bits each move takes.
+};
+
+/**
+ * @brief A growable sequence of Simon moves packed a few bits per move.
+ */
+class MoveSequence {
+public:
+    /// Storage is reserved in whole chunks of this many 64-bit words.
+    static constexpr qsizetype ChunkWords = 64;
+
+    /**
+     * @brief Returns the number of bits needed per move for a number of colors.
+     * @param colors Number of colors, in [2, 16].
+     * @return ceil(log2(colors)), at least 1.
+     */
+    static constexpr int bitsForColors(int colors) {
+        int bits = 1;
+        while ((1 << bits) < colors)
+            bits++;
+        return bits;
+    }
+
+    /**
+     * @brief Constructs an empty sequence.
+     * @param bitsPerMove Number of bits each move takes, in [1, 4].
+     */
+    explicit MoveSequence(int bitsPerMove = 1)
+        : m_bitsPerMove(bitsPerMove) {
+        Q_ASSERT(bitsPerMove >= 1 && bitsPerMove <= 4);
+    }
+
+    /**
+     * @brief Returns the number of moves in the sequence.
+     */
+    qsizetype size() const { return m_size; }
+
+    /**
+     * @brief Returns true if the sequence holds no moves.
+     */
+    bool isEmpty() const { return m_size == 0; }
+
+    /**
+     * @brief Returns the number of bits each move takes.
+     */
+    int bitsPerMove() const { return m_bitsPerMove; }
+
+    /**
+     * @brief Returns the move at the given index.
+     * @param i Index of the move; must be in [0, size()).
+     * @return The color index of the move (0 for Red, 1 for Blue, ...).
+     */
+    int at(qsizetype i) const { return view().at(i); }
+
+    int operator[](qsizetype i) const { return at(i); }
+
+    /**
+     * @brief Appends a move to the end of the sequence.
+     * @param move The color index of the move; must fit in bitsPerMove() bits.
+     */
+    void append(int move) {
+        Q_ASSERT(move >= 0 && move < (1 << m_bitsPerMove));
+        const qsizetype offset = m_size * m_bitsPerMove;
+        const qsizetype lastWord = (offset + m_bitsPerMove - 1) >> 6;
+        while (lastWord >= m_words.size()) {
+            // Double the storage, in whole chunks, so long games copy each word O(1) times.
+            if (m_words.size() == m_words.capacity()) {
+                const qsizetype wanted = qMax(ChunkWords, m_words.capacity() * 2);
+                m_words.reserve((wanted + ChunkWords - 1) / ChunkWords * ChunkWords);
+            }
+            m_words.append(0);
+        }
+        const qsizetype word = offset >> 6;
+        const int shift = static_cast<int>(offset & 63);
+        const quint64 bits = static_cast<quint64>(move);
+        m_words[word] |= bits << shift;
+        // The move straddles two words.
+        if (shift + m_bitsPerMove > 64)
+            m_words[word + 1] |= bits >> (64 - shift);
+        m_size++;
+    }
+
+    /**
+     * @brief Removes all moves. Reserved storage is kept for the next game.
+     */
+    void clear() {
+        m_words.clear();
+        m_size = 0;
+    }
+
+    /**
+     * @brief Returns a non-owning view of the current moves.
+     */
+    MoveSequenceView view() const {
+        return MoveSequenceView(m_words.constData(), m_size, m_bitsPerMove);
+    }
+
+private:
+    QVector<quint64> m_words; ///< Packed moves, move i at bit i * m_bitsPerMove.
+    qsizetype m_size = 0;     ///< Number of valid moves.
+    int m_bitsPerMove;        ///< Number of bits each move takes.
+};
+
+#endif // MOVESEQUENCE_H
@@ -0,0 +1,96 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * padanimator.cpp
+ *
+ * This file implements the PadAnimator class for the Simon game. A move
+ * only rewrites the start and end values of the existing animations;
+ * duration and easing are set once per animation, not per move.
+ */
+
+#include "padanimator.h"
+#include "tracer.h"
+
+PadAnimator::PadAnimator(QObject *parent)
+    : QObject(parent),
+    m_duration(1000),
+    m_easing(QEasingCurve::OutBounce)
+{
+    connect(&m_group, &QAbstractAnimation::finished, this, []() {
+        Tracer::instant("PadAnimator::finished", "animation");
+    });
+}
+
+void PadAnimator::setDuration(int ms) {
+    m_duration = ms;
+    for (QPropertyAnimation *anim : std::as_const(m_animations))
+        anim->setDuration(ms);
+}
+
+void PadAnimator::setEasingCurve(const QEasingCurve &curve) {
+    m_easing = curve;
+    for (QPropertyAnimation *anim : std::as_const(m_animations))
+        anim->setEasingCurve(curve);
+}
+
+void PadAnimator::addPad(QWidget *pad) {
+    if (animationFor(pad))
+        return;
+    // A running group would start the new animation at once and pin the pad.
+    m_group.stop();
+    // The group owns the animation; it lives as long as the pad does.
+    QPropertyAnimation *anim = new QPropertyAnimation(pad, "pos");
+    anim->setDuration(m_duration);
+    anim->setEasingCurve(m_easing);
+    anim->setStartValue(pad->pos());
+    anim->setEndValue(pad->pos());
+    m_group.addAnimation(anim);
+    m_animations.append(anim);
+}
+
+void PadAnimator::removePad(QWidget *pad) {
+    QPropertyAnimation *anim = animationFor(pad);
+    if (!anim)
+        return;
+    // The other pads stay where they are instead of finishing their move.
+    m_group.stop();
+    m_animations.removeOne(anim);
+    m_group.removeAnimation(anim);
+    delete anim;
+}
+
+void PadAnimator::retarget() {
+    if (isRunning())
+        Tracer::instant("PadAnimator::interrupted", "animation");
+    // Stopping leaves every pad at the position of the last frame.
+    m_group.stop();
+    for (QPropertyAnimation *anim : std::as_const(m_animations)) {
+        const QPoint pos = static_cast<QWidget*>(anim->targetObject())->pos();
+        anim->setStartValue(pos);
+        anim->setEndValue(pos);
+    }
+}
+
+void PadAnimator::setTarget(QWidget *pad, const QPoint &target) {
+    QPropertyAnimation *anim = animationFor(pad);
+    Q_ASSERT(anim);
+    if (anim)
+        anim->setEndValue(target);
+}
+
+void PadAnimator::start() {
+    Tracer::instant("PadAnimator::start", "animation");
+    m_group.start();
+}
+
+QPropertyAnimation *PadAnimator::animationFor(QWidget *pad) const {
+    // Boards have at most a few dozen pads; a scan beats a hash lookup here.
+    for (QPropertyAnimation *anim : m_animations) {
+        if (anim->targetObject() == pad)
+            return anim;
+    }
+    return nullptr;
+}
@@ -0,0 +1,107 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * padanimator.h
+ *
+ * This file declares the PadAnimator class for the Simon game.
+ * The PadAnimator moves the pads of a board with one persistent
+ * QParallelAnimationGroup holding one "pos" animation per pad. The
+ * animations are created when a pad is added and reused for every move, so
+ * a round allocates nothing, and there is never more than one animation
+ * writing a pad's position.
+ *
+ * Starting a new move while the previous one is still in flight retargets
+ * the pads: every pad starts from wherever it is at that moment, so a fast
+ * round redirects the motion instead of jumping or fighting the old
+ * animation.
+ *
+ * Usage:
+ *  - Call addPad() for every pad and removePad() before deleting one.
+ *  - Call retarget() to begin a move; all pads hold their current position.
+ *  - Call setTarget() for each pad that should move, then start().
+ */
+
+#ifndef PADANIMATOR_H
+#define PADANIMATOR_H
+
+#include <QObject>
+#include <QParallelAnimationGroup>
+#include <QPoint>
+#include <QPropertyAnimation>
+#include <QVector>
+#include <QWidget>
+
+class PadAnimator : public QObject {
+    Q_OBJECT
+public:
+    /**
+     * @brief Constructs a PadAnimator without pads.
+     * @param parent Optional parent QObject.
+     */
+    explicit PadAnimator(QObject *parent = nullptr);
+
+    /**
+     * @brief Sets the duration of a move (1000 ms by default).
+     * @param ms The duration in milliseconds.
+     */
+    void setDuration(int ms);
+
+    /**
+     * @brief Sets the easing curve of a move (OutBounce by default).
+     * @param curve The easing curve.
+     */
+    void setEasingCurve(const QEasingCurve &curve);
+
+    /**
+     * @brief Creates the reusable animation of a pad, stopping the move in progress.
+     * @param pad The pad to animate; ignored if it was already added.
+     */
+    void addPad(QWidget *pad);
+
+    /**
+     * @brief Deletes the animation of a pad, stopping the move in progress.
+     * @param pad The pad that is about to be deleted.
+     */
+    void removePad(QWidget *pad);
+
+    /**
+     * @brief Stops the move in progress and pins every pad where it is.
+     *
+     * Pads not given a new target by setTarget() stay at that position
+     * for the next move.
+     */
+    void retarget();
+
+    /**
+     * @brief Sets where a pad moves to, from its current position.
+     * @param pad A pad added with addPad().
+     * @param target The new top-left position of the pad.
+     */
+    void setTarget(QWidget *pad, const QPoint &target);
+
+    /**
+     * @brief Starts moving the pads to their targets.
+     */
+    void start();
+
+    /**
+     * @brief Returns true while the pads are moving.
+     */
+    bool isRunning() const { return m_group.state() == QAbstractAnimation::Running; }
+
+private:
+    /**
+     * @brief Returns the animation of a pad, or nullptr if it was not added.
+     */
+    QPropertyAnimation *animationFor(QWidget *pad) const;
+
+    QParallelAnimationGroup m_group;          ///< Runs the moves of all pads together.
+    QVector<QPropertyAnimation*> m_animations; ///< One animation per pad, owned by the group.
+    int m_duration;                            ///< Duration of a move in milliseconds.
+    QEasingCurve m_easing;                     ///< Easing curve of a move.
+};
+
+#endif // PADANIMATOR_H
@@ -0,0 +1,47 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * padcolor.h
+ *
+ * This file declares PadColor, the typed identifier of a Simon pad used by
+ * the Model's input API. The first four values name the pads of the classic
+ * game; boards with more colors use the values up to 15, which can be made
+ * from an index with padColor().
+ */
+
+#ifndef PADCOLOR_H
+#define PADCOLOR_H
+
+#include <QMetaType>
+#include <QtGlobal>
+
+enum class PadColor : quint8 {
+    Red = 0,
+    Blue = 1,
+    Green = 2,
+    Yellow = 3
+};
+
+/// Smallest number of colors a game can have.
+constexpr int MinColors = 2;
+
+/// Largest number of colors a game can have; moves then take four bits.
+constexpr int MaxColors = 16;
+
+/**
+ * @brief Returns the pad color with the given index.
+ * @param index The color index, in [0, MaxColors).
+ */
+constexpr PadColor padColor(int index) { return static_cast<PadColor>(index); }
+
+/**
+ * @brief Returns the index of a pad color.
+ */
+constexpr int padIndex(PadColor color) { return static_cast<int>(color); }
+
+Q_DECLARE_METATYPE(PadColor)
+
+#endif // PADCOLOR_H
@@ -0,0 +1,166 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * padinput.cpp
+ *
+ * This file implements the PadInput class for the Simon game. Mouse and
+ * touch presses land on the board because the pads let them through; keys
+ * not used by the focused widget are passed up to the window, where the
+ * filter picks them up.
+ */
+
+#include "padinput.h"
+#include "gameclock.h"
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QTouchEvent>
+#include <iterator>
+#include <limits>
+
+namespace {
+
+/// The key of each pad, in color order.
+const int padKeys[] = {
+    Qt::Key_1, Qt::Key_2, Qt::Key_3, Qt::Key_4, Qt::Key_5,
+    Qt::Key_6, Qt::Key_7, Qt::Key_8, Qt::Key_9, Qt::Key_0,
+    Qt::Key_Q, Qt::Key_W, Qt::Key_E, Qt::Key_R, Qt::Key_T, Qt::Key_Y,
+};
+
+/// A delivery this much later than the fastest one means the platform clock was reset.
+constexpr qint64 MaxDeliveryUs = 1000 * 1000;
+
+}
+
+PadInput::PadInput(QWidget *board, QObject *parent)
+    : QObject(parent),
+    m_board(board),
+    m_clockOffsetUs(std::numeric_limits<qint64>::max())
+{
+    m_board->setAttribute(Qt::WA_AcceptTouchEvents);
+    m_board->installEventFilter(this);
+    m_board->window()->installEventFilter(this);
+}
+
+void PadInput::addPad(QAbstractButton *pad) {
+    // Presses go through the pad to the board, where they are hit-tested.
+    pad->setAttribute(Qt::WA_TransparentForMouseEvents);
+    pad->setFocusPolicy(Qt::NoFocus);
+    m_pads.append(pad);
+}
+
+void PadInput::removePad(QAbstractButton *pad) {
+    m_pads.removeOne(pad);
+}
+
+int PadInput::padForKey(int key) {
+    for (int i = 0; i < int(std::size(padKeys)); i++) {
+        if (padKeys[i] == key)
+            return i;
+    }
+    return -1;
+}
+
+int PadInput::padAt(const QPoint &pos) const {
+    // Pads never overlap, so the first hit is the only one.
+    for (int i = 0; i < m_pads.size(); i++) {
+        const QAbstractButton *pad = m_pads[i];
+        if (pad->isVisible() && pad->geometry().contains(pos))
+            return i;
+    }
+    return -1;
+}
+
+qint64 PadInput::inputTimeUs(const QInputEvent *event) {
+    const qint64 nowUs = SystemClock::instance()->nowUs();
+    const qint64 eventUs = qint64(event->timestamp()) * 1000;
+    // Synthesized events may carry no timestamp.
+    if (eventUs == 0)
+        return nowUs;
+    // Platform timestamps count from their own origin. No event arrives before it
+    // happened, so the smallest gap between arrival and timestamp is the offset
+    // between the clocks.
+    const qint64 gapUs = nowUs - eventUs;
+    if (gapUs < m_clockOffsetUs || gapUs - m_clockOffsetUs > MaxDeliveryUs)
+        m_clockOffsetUs = gapUs;
+    return eventUs + m_clockOffsetUs;
+}
+
+void PadInput::press(int pad, qint64 inputUs) {
+    // The pad looks pressed until the pointer goes up, wherever the pad has moved to.
+    m_pads[pad]->setDown(true);
+    emit padPressed(pad, inputUs);
+}
+
+void PadInput::releaseAll() {
+    for (QAbstractButton *pad : std::as_const(m_pads)) {
+        if (pad->isDown())
+            pad->setDown(false);
+    }
+}
+
+bool PadInput::eventFilter(QObject *watched, QEvent *event) {
+    if (watched == m_board) {
+        switch (event->type()) {
+        case QEvent::MouseButtonPress: {
+            QMouseEvent *mouse = static_cast<QMouseEvent*>(event);
+            if (mouse->button() != Qt::LeftButton)
+                return false;
+            const int pad = padAt(mouse->position().toPoint());
+            if (pad < 0)
+                return false;
+            press(pad, inputTimeUs(mouse));
+            return true;
+        }
+        case QEvent::MouseButtonDblClick:
+            // The press of a double click already arrived as MouseButtonPress.
+            return padAt(static_cast<QMouseEvent*>(event)->position().toPoint()) >= 0;
+        case QEvent::MouseButtonRelease:
+            releaseAll();
+            return false;
+        case QEvent::TouchBegin:
+        case QEvent::TouchUpdate: {
+            // Every finger that went down since the last event presses the pad under it.
+            QTouchEvent *touch = static_cast<QTouchEvent*>(event);
+            bool hit = false;
+            for (const QEventPoint &point : touch->points()) {
+                if (point.state() != QEventPoint::Pressed)
+                    continue;
+                const int pad = padAt(point.position().toPoint());
+                if (pad >= 0) {
+                    press(pad, inputTimeUs(touch));
+                    hit = true;
+                }
+            }
+            // A touch that starts off the pads becomes a mouse press, e.g. for the Start button.
+            if (!hit && event->type() == QEvent::TouchBegin)
+                return false;
+            // Accept the sequence so later fingers arrive as updates.
+            event->accept();
+            return true;
+        }
+        case QEvent::TouchEnd:
+        case QEvent::TouchCancel:
+            releaseAll();
+            event->accept();
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    if (event->type() == QEvent::KeyPress) {
+        QKeyEvent *key = static_cast<QKeyEvent*>(event);
+        // Leave shortcuts with modifiers, such as Ctrl+L, to the window.
+        if (key->isAutoRepeat() || (key->modifiers() & ~Qt::KeypadModifier))
+            return false;
+        const int pad = padForKey(key->key());
+        if (pad < 0 || pad >= m_pads.size())
+            return false;
+        emit padPressed(pad, inputTimeUs(key));
+        return true;
+    }
+    return false;
+}
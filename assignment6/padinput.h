@@ -0,0 +1,110 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * padinput.h
+ *
+ * This file declares the PadInput class for the Simon game.
+ * PadInput turns mouse presses, touches and keys into pad presses the
+ * moment they go down. QPushButton::clicked() only fires when the button is
+ * released over the button. That adds the hold time to every press. It
+ * also drops a press when the pad moves away under the pointer. PadInput
+ * makes the pads transparent to mouse events and takes the presses on the
+ * board instead. It hit-tests them against the pads' current (possibly
+ * animated) geometry.
+ *
+ * Keys 1-9 and 0 press the first ten pads and Q, W, E, R, T, Y the other
+ * six. Auto-repeated keys are ignored. Every press carries the time of
+ * the event that caused it, moved from the platform's clock to
+ * SystemClock::instance() so the Model can journal it.
+ *
+ * Usage:
+ *  - Construct it with the board the pads live on.
+ *  - Call addPad() for every pad, in color order, and removePad() before
+ *    deleting one.
+ *  - Connect to padPressed().
+ */
+
+#ifndef PADINPUT_H
+#define PADINPUT_H
+
+#include <QAbstractButton>
+#include <QInputEvent>
+#include <QObject>
+#include <QPoint>
+#include <QVector>
+
+class PadInput : public QObject {
+    Q_OBJECT
+public:
+    /**
+     * @brief Constructs the input layer and starts watching the board and its window.
+     * @param board The widget the pads are children of.
+     * @param parent Optional parent QObject.
+     */
+    explicit PadInput(QWidget *board, QObject *parent = nullptr);
+
+    /**
+     * @brief Adds the next pad; its index is the number of pads added before it.
+     * @param pad The pad; it stops receiving mouse events and keyboard focus.
+     */
+    void addPad(QAbstractButton *pad);
+
+    /**
+     * @brief Removes a pad before it is deleted.
+     * @param pad A pad added with addPad().
+     */
+    void removePad(QAbstractButton *pad);
+
+    /**
+     * @brief Returns the pad a key presses, or -1 for other keys.
+     * @param key A Qt::Key value.
+     */
+    static int padForKey(int key);
+
+signals:
+    /**
+     * @brief Emitted when a pad is pressed down.
+     * @param pad Index of the pad (0 for Red, 1 for Blue, ...).
+     * @param inputUs Time of the input event, from SystemClock::nowUs().
+     */
+    void padPressed(int pad, qint64 inputUs);
+
+protected:
+    /**
+     * @brief Takes mouse and touch presses on the board and key presses on its window.
+     * @param watched The board or its window.
+     * @param event The event to look at.
+     * @return True if the event pressed a pad.
+     */
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    /**
+     * @brief Returns the index of the visible pad under a board position, or -1.
+     */
+    int padAt(const QPoint &pos) const;
+
+    /**
+     * @brief Returns the time of an input event on SystemClock::instance(), in microseconds.
+     */
+    qint64 inputTimeUs(const QInputEvent *event);
+
+    /**
+     * @brief Shows a pad as held down and emits padPressed().
+     */
+    void press(int pad, qint64 inputUs);
+
+    /**
+     * @brief Shows every held pad as released again.
+     */
+    void releaseAll();
+
+    QWidget *m_board;                 ///< The widget the pads are children of.
+    QVector<QAbstractButton*> m_pads; ///< The pads indexed by color.
+    qint64 m_clockOffsetUs;           ///< SystemClock time minus platform time, in microseconds.
+};
+
+#endif // PADINPUT_H
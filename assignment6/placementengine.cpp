@@ -0,0 +1,108 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * placementengine.cpp
+ *
+ * This file implements the PlacementEngine. Cells are conservative: a cell
+ * touched by any obstacle is occupied, and a placed rectangle covers whole
+ * cells, so a returned position never overlaps an obstacle.
+ */
+
+#include "placementengine.h"
+#include <QRandomGenerator>
+
+PlacementEngine::PlacementEngine(int cellSize)
+    : m_cellSize(qMax(1, cellSize)),
+    m_cols(0),
+    m_rows(0),
+    m_sumsValid(false)
+{
+}
+
+void PlacementEngine::reset(const QRect &area) {
+    m_area = area;
+    // Only cells that lie entirely inside the area can be used.
+    m_cols = qMax(0, area.width() / m_cellSize);
+    m_rows = qMax(0, area.height() / m_cellSize);
+    m_cells.fill(0, m_cols * m_rows);
+    m_sumsValid = false;
+}
+
+void PlacementEngine::addObstacle(const QRect &rect) {
+    QRect local = rect.translated(-m_area.topLeft());
+    if (local.isEmpty() || local.right() < 0 || local.bottom() < 0)
+        return;
+    // Mark every cell the rectangle touches, clamped to the grid.
+    int firstCol = qMax(0, local.left() / m_cellSize);
+    int lastCol = qMin(m_cols - 1, local.right() / m_cellSize);
+    int firstRow = qMax(0, local.top() / m_cellSize);
+    int lastRow = qMin(m_rows - 1, local.bottom() / m_cellSize);
+    for (int row = firstRow; row <= lastRow; row++) {
+        for (int col = firstCol; col <= lastCol; col++)
+            m_cells[row * m_cols + col] = 1;
+    }
+    m_sumsValid = false;
+}
+
+int PlacementEngine::countPositions(const QSize &size) {
+    rebuildSums();
+    int cols = (size.width() + m_cellSize - 1) / m_cellSize;
+    int rows = (size.height() + m_cellSize - 1) / m_cellSize;
+    int count = 0;
+    for (int row = 0; row + rows <= m_rows; row++) {
+        for (int col = 0; col + cols <= m_cols; col++) {
+            if (isFree(col, row, cols, rows))
+                count++;
+        }
+    }
+    return count;
+}
+
+std::optional<QRect> PlacementEngine::place(const QSize &size, QRandomGenerator *rng) {
+    // First pass: count the free positions so one can be drawn uniformly.
+    int count = countPositions(size);
+    if (count == 0)
+        return std::nullopt;
+    int pick = static_cast<int>(rng->bounded(count));
+
+    // Second pass: walk to the chosen position.
+    int cols = (size.width() + m_cellSize - 1) / m_cellSize;
+    int rows = (size.height() + m_cellSize - 1) / m_cellSize;
+    for (int row = 0; row + rows <= m_rows; row++) {
+        for (int col = 0; col + cols <= m_cols; col++) {
+            if (!isFree(col, row, cols, rows) || pick-- > 0)
+                continue;
+            QRect placed(m_area.left() + col * m_cellSize, m_area.top() + row * m_cellSize,
+                         size.width(), size.height());
+            // The placed rectangle is an obstacle for the next ones.
+            addObstacle(placed);
+            return placed;
+        }
+    }
+    return std::nullopt;
+}
+
+void PlacementEngine::rebuildSums() {
+    if (m_sumsValid)
+        return;
+    const int stride = m_cols + 1;
+    m_sums.fill(0, stride * (m_rows + 1));
+    for (int row = 0; row < m_rows; row++) {
+        int rowSum = 0;
+        for (int col = 0; col < m_cols; col++) {
+            rowSum += m_cells[row * m_cols + col];
+            m_sums[(row + 1) * stride + col + 1] = m_sums[row * stride + col + 1] + rowSum;
+        }
+    }
+    m_sumsValid = true;
+}
+
+bool PlacementEngine::isFree(int col, int row, int cols, int rows) const {
+    const int stride = m_cols + 1;
+    int occupied = m_sums[(row + rows) * stride + col + cols] - m_sums[row * stride + col + cols]
+                   - m_sums[(row + rows) * stride + col] + m_sums[row * stride + col];
+    return occupied == 0;
+}
@@ -0,0 +1,86 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * placementengine.h
+ *
+ * This file declares the PlacementEngine used to find new positions for the
+ * Simon pads. The engine keeps an occupancy grid over the board: obstacles
+ * and already placed pads mark the cells they touch. To place a pad, a
+ * summed-area table of the grid tells in O(1) whether a block of cells is
+ * free, so every valid position is known and one is drawn uniformly at
+ * random. Placement takes time proportional to the number of cells no matter
+ * how many pads and obstacles there are, and it reports failure instead of
+ * returning an overlapping position.
+ *
+ * Usage:
+ *  - reset() with the board area, then addObstacle() for every fixed widget.
+ *  - Call place() once per pad; each placed pad becomes an obstacle.
+ */
+
+#ifndef PLACEMENTENGINE_H
+#define PLACEMENTENGINE_H
+
+#include <QRect>
+#include <QSize>
+#include <QVector>
+#include <optional>
+
+class QRandomGenerator;
+
+class PlacementEngine {
+public:
+    /**
+     * @brief Constructs an engine with an empty area.
+     * @param cellSize Edge of a grid cell in pixels; positions are multiples of it.
+     */
+    explicit PlacementEngine(int cellSize = 8);
+
+    /**
+     * @brief Clears the grid and sets the area rectangles are placed in.
+     * @param area The board area.
+     */
+    void reset(const QRect &area);
+
+    /**
+     * @brief Marks every cell a rectangle touches as occupied.
+     * @param rect The obstacle, in the same coordinates as the area.
+     */
+    void addObstacle(const QRect &rect);
+
+    /**
+     * @brief Returns the number of positions a rectangle of the given size could take.
+     */
+    int countPositions(const QSize &size);
+
+    /**
+     * @brief Places a rectangle at a uniformly random free position and marks it occupied.
+     * @param size Size of the rectangle to place.
+     * @param rng Random generator to draw the position with.
+     * @return The placed rectangle, or std::nullopt if no free position is left.
+     */
+    std::optional<QRect> place(const QSize &size, QRandomGenerator *rng);
+
+private:
+    /**
+     * @brief Rebuilds the summed-area table after the grid changed.
+     */
+    void rebuildSums();
+
+    /**
+     * @brief Returns true if the block of cells starting at (col, row) is free.
+     */
+    bool isFree(int col, int row, int cols, int rows) const;
+
+    int m_cellSize;           ///< Edge of a grid cell in pixels.
+    QRect m_area;             ///< The board area.
+    int m_cols;               ///< Number of grid columns.
+    int m_rows;               ///< Number of grid rows.
+    QVector<quint8> m_cells;  ///< 1 for occupied cells, row-major.
+    QVector<int> m_sums;      ///< Summed-area table of m_cells, (m_cols + 1) x (m_rows + 1).
+    bool m_sumsValid;         ///< False when m_cells changed since the last rebuild.
+};
+
+#endif // PLACEMENTENGINE_H
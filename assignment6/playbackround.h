@@ -0,0 +1,111 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * playbackround.h
+ *
+ * This file declares the PlaybackRound value published by the Model once
+ * per round. It bundles an immutable handle to the sequence with the tempo
+ * the round should be played at, so the view can drive the whole playback
+ * locally instead of receiving one signal per move.
+ *
+ * The handle is either a snapshot of the packed sequence or, for Models in
+ * seeded mode, just the seed and the length, in which case moves are
+ * recomputed with CounterRng. Copying a PlaybackRound is cheap in both
+ * cases: packed words are implicitly shared with the Model until the Model
+ * appends the next move.
+ */
+
+#ifndef PLAYBACKROUND_H
+#define PLAYBACKROUND_H
+
+#include <QMetaType>
+#include "movesequence.h"
+#include "counterrng.h"
+#include "padcolor.h"
+
+class PlaybackRound {
+public:
+    /**
+     * @brief Constructs an empty round with no moves.
+     */
+    PlaybackRound()
+        : m_seed(0), m_colors(MinColors), m_size(0), m_seeded(false), m_round(0), m_stepMs(0) {}
+
+    /**
+     * @brief Constructs a round from a snapshot of the sequence.
+     * @param moves The sequence to play; shared, not deep-copied.
+     * @param round The round number.
+     * @param stepMs Time between the start of two consecutive flashes, in milliseconds.
+     */
+    PlaybackRound(const MoveSequence &moves, int round, int stepMs)
+        : m_moves(moves), m_seed(0), m_colors(0), m_size(moves.size()),
+        m_seeded(false), m_round(round), m_stepMs(stepMs) {}
+
+    /**
+     * @brief Constructs a round whose moves are derived from a seed.
+     * @param seed The seed the moves are generated from.
+     * @param colors Number of colors of the game.
+     * @param size Number of moves to play.
+     * @param round The round number.
+     * @param stepMs Time between the start of two consecutive flashes, in milliseconds.
+     */
+    PlaybackRound(quint64 seed, int colors, qsizetype size, int round, int stepMs)
+        : m_seed(seed), m_colors(colors), m_size(size), m_seeded(true), m_round(round), m_stepMs(stepMs) {}
+
+    /**
+     * @brief Returns the move at the given index.
+     * @param i Index of the move; must be in [0, size()).
+     * @return The color index of the move.
+     */
+    int at(qsizetype i) const {
+        return m_seeded ? CounterRng::moveAt(m_seed, static_cast<quint64>(i), m_colors) : m_moves.at(i);
+    }
+
+    /**
+     * @brief Returns a view of the packed moves.
+     *
+     * The view is empty for seeded rounds; use at() to read those.
+     */
+    MoveSequenceView moves() const { return m_moves.view(); }
+
+    /**
+     * @brief Returns the number of moves to play.
+     */
+    qsizetype size() const { return m_size; }
+
+    /**
+     * @brief Returns true if the moves are derived from a seed instead of stored.
+     */
+    bool isSeeded() const { return m_seeded; }
+
+    /**
+     * @brief Returns the round number the moves belong to.
+     */
+    int round() const { return m_round; }
+
+    /**
+     * @brief Returns the time between the start of two consecutive flashes.
+     */
+    int stepMs() const { return m_stepMs; }
+
+    /**
+     * @brief Returns how long each move stays lit (half of the step).
+     */
+    int flashMs() const { return m_stepMs / 2; }
+
+private:
+    MoveSequence m_moves; ///< Shared snapshot of the sequence (stored rounds only).
+    quint64 m_seed;       ///< Seed of the moves (seeded rounds only).
+    int m_colors;         ///< Number of colors the moves are drawn from (seeded rounds only).
+    qsizetype m_size;     ///< Number of moves to play.
+    bool m_seeded;        ///< True if the moves are derived from m_seed.
+    int m_round;          ///< The round number.
+    int m_stepMs;         ///< Time between two flashes, in milliseconds.
+};
+
+Q_DECLARE_METATYPE(PlaybackRound)
+
+#endif // PLAYBACKROUND_H
@@ -0,0 +1,116 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * playbackscheduler.cpp
+ *
+ * This file implements the PlaybackScheduler class for the Simon game.
+ * The scheduler holds the frame driver while it plays; every frame counts
+ * down to the next flash edge while a cursor walks the moves of the round.
+ * A session owns no timers or queued work, so cancelling one is a flag, a
+ * counter bump and a release of the frame driver.
+ */
+
+#include "playbackscheduler.h"
+#include "tracer.h"
+
+PlaybackScheduler::PlaybackScheduler(FrameDriver *frames, QObject *parent)
+    : QObject(parent),
+    m_frames(frames),
+    m_generation(0),
+    m_cursor(0),
+    m_playing(false),
+    m_lit(false),
+    m_framesLeft(0),
+    m_onFrames(1),
+    m_offFrames(1)
+{
+    connect(m_frames, &FrameDriver::frame, this, &PlaybackScheduler::onFrame);
+}
+
+PlaybackScheduler::~PlaybackScheduler() {
+    if (m_playing)
+        m_frames->release();
+}
+
+quint64 PlaybackScheduler::play(const PlaybackRound &round) {
+    // Abandon whatever was playing before and rewind the cursor.
+    cancel();
+    m_round = round;
+    m_cursor = 0;
+
+    // A move is lit for the flash time and dark for the rest of the step,
+    // each for at least one frame so every flash is seen.
+    m_onFrames = framesFor(round.flashMs());
+    m_offFrames = framesFor(round.stepMs() - round.flashMs());
+
+    // Light the first move on the next frame.
+    m_framesLeft = 0;
+    m_playing = true;
+    m_frames->hold();
+    return m_generation;
+}
+
+void PlaybackScheduler::cancel() {
+    // Everything tagged with the old generation is now stale.
+    m_generation++;
+    // Never leave a button stuck in its flashed state.
+    if (m_lit) {
+        m_lit = false;
+        emit flashChanged(m_round.at(m_cursor), false);
+    }
+    if (m_playing) {
+        m_playing = false;
+        m_frames->release();
+    }
+    // Let go of the sequence snapshot so the Model can grow it without copying.
+    m_round = PlaybackRound();
+}
+
+void PlaybackScheduler::finish() {
+    Tracer::instant("PlaybackScheduler::finished", "playback");
+    m_playing = false;
+    m_frames->release();
+    m_round = PlaybackRound();
+    emit finished(m_generation);
+}
+
+void PlaybackScheduler::onFrame() {
+    if (!m_playing)
+        return;
+    // Keep the current phase on screen until its frames are used up.
+    if (m_framesLeft > 1) {
+        m_framesLeft--;
+        return;
+    }
+
+    if (m_cursor >= m_round.size()) {
+        // The round has no moves to play.
+        finish();
+        return;
+    }
+
+    if (!m_lit) {
+        // Light the move under the cursor and keep it lit for the on frames.
+        m_lit = true;
+        m_framesLeft = m_onFrames;
+        Tracer::Scope trace("PlaybackScheduler::flashOn", "playback");
+        emit flashChanged(m_round.at(m_cursor), true);
+        return;
+    }
+
+    // Turn the move off and advance to the next one.
+    m_lit = false;
+    {
+        Tracer::Scope trace("PlaybackScheduler::flashOff", "playback");
+        emit flashChanged(m_round.at(m_cursor), false);
+    }
+    m_cursor++;
+    if (m_cursor >= m_round.size()) {
+        finish();
+        return;
+    }
+    m_framesLeft = m_offFrames;
+}
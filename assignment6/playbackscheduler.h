@@ -0,0 +1,136 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * playbackscheduler.h
+ *
+ * This file declares the PlaybackScheduler class for the Simon game.
+ * The PlaybackScheduler plays a round of the sequence back to the player
+ * on the frames of a FrameDriver. A cursor walks the round's moves and,
+ * whenever its frame countdown runs out, either lights the current move or
+ * turns it off and advances the cursor, so playback costs a counter
+ * decrement per frame no matter how long the sequence is.
+ *
+ * Durations are rounded to whole frames and every lit and dark phase lasts
+ * at least one frame. At fast tempos, where a step is shorter than two
+ * frames, playback slows down to one move per two frames instead of
+ * dropping or merging flashes; a late frame delays the sequence rather than
+ * skipping an edge.
+ *
+ * Every play() opens a new session tagged with a generation number.
+ * cancel() ends the session in O(1): it turns off the lit button, lets go
+ * of the frame driver and bumps the generation, so nothing of the old
+ * session runs again and receivers of finished() can tell stale
+ * notifications apart.
+ *
+ * Usage:
+ *  - Call play() with the PlaybackRound published by the Model.
+ *  - Connect to flashChanged() to light and unlight the buttons.
+ *  - finished() is emitted after the last move has been turned off.
+ *  - Call cancel() when the game restarts, is lost or the view goes away.
+ */
+
+#ifndef PLAYBACKSCHEDULER_H
+#define PLAYBACKSCHEDULER_H
+
+#include <QObject>
+#include "framedriver.h"
+#include "playbackround.h"
+
+class PlaybackScheduler : public QObject {
+    Q_OBJECT
+public:
+    /**
+     * @brief Constructs an idle PlaybackScheduler.
+     * @param frames The frame loop playback steps on; must outlive the scheduler.
+     * @param parent Optional parent QObject.
+     */
+    explicit PlaybackScheduler(FrameDriver *frames, QObject *parent = nullptr);
+
+    /**
+     * @brief Gives back the frame driver if a session is still running.
+     *
+     * Buttons are not touched; owners that outlive their buttons' flashes
+     * should call cancel() first.
+     */
+    ~PlaybackScheduler() override;
+
+    /**
+     * @brief Returns the number of frames a duration lasts, at least one.
+     * @param ms The duration in milliseconds.
+     */
+    static int framesFor(int ms) {
+        return qMax(1, (ms + FrameDriver::FrameMs / 2) / FrameDriver::FrameMs);
+    }
+
+    /**
+     * @brief Starts a new session, cancelling the session in progress.
+     *
+     * Each move is lit for the round's flash time and the next move is lit
+     * one full step after the previous one, both rounded to whole frames.
+     * The first move is lit on the next frame.
+     *
+     * @param round The moves and tempo to play.
+     * @return The generation of the new session.
+     */
+    quint64 play(const PlaybackRound &round);
+
+    /**
+     * @brief Cancels the session in progress in O(1).
+     *
+     * Turns off a lit button, stops taking frames, drops the round and
+     * moves to a new generation; the cancelled session never emits
+     * finished().
+     */
+    void cancel();
+
+    /**
+     * @brief Returns the generation of the current (or last cancelled) session.
+     */
+    quint64 generation() const { return m_generation; }
+
+    /**
+     * @brief Returns true while moves are still being played.
+     */
+    bool isPlaying() const { return m_playing; }
+
+signals:
+    /**
+     * @brief Emitted when a button has to be lit or turned off.
+     * @param button Identifier of the button (0 for Red, 1 for Blue).
+     * @param lit True to show the flash, false to restore the button.
+     */
+    void flashChanged(int button, bool lit);
+
+    /**
+     * @brief Emitted once the last move of the round has been turned off.
+     * @param generation The generation of the session that finished.
+     */
+    void finished(quint64 generation);
+
+private slots:
+    /**
+     * @brief Advances the playback by one frame.
+     */
+    void onFrame();
+
+private:
+    /**
+     * @brief Ends the playback and gives back the frame driver.
+     */
+    void finish();
+
+    FrameDriver *m_frames;  ///< The frame loop playback steps on.
+    quint64 m_generation;   ///< Generation of the current session; bumped by cancel().
+    PlaybackRound m_round;  ///< The round being played.
+    qsizetype m_cursor;     ///< Index of the move being played.
+    bool m_playing;         ///< True while the round is being played.
+    bool m_lit;             ///< True while the move at the cursor is lit.
+    int m_framesLeft;       ///< Frames until the next flash edge.
+    int m_onFrames;         ///< How many frames a move stays lit.
+    int m_offFrames;        ///< Dark frames between turning a move off and lighting the next one.
+};
+
+#endif // PLAYBACKSCHEDULER_H
@@ -0,0 +1,33 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * pressbatchresult.h
+ *
+ * This file declares the PressBatchResult returned by Model::checkPresses.
+ * It reports how a whole burst of presses played out: how many presses
+ * matched, where the first wrong press was, and how many rounds the burst
+ * completed on the way.
+ */
+
+#ifndef PRESSBATCHRESULT_H
+#define PRESSBATCHRESULT_H
+
+#include <QtGlobal>
+
+struct PressBatchResult {
+    qsizetype accepted = 0;       ///< Number of presses that matched the sequence.
+    qsizetype mismatchIndex = -1; ///< Index in the batch of the first wrong press, or -1.
+    int roundsCompleted = 0;      ///< Rounds finished during the batch.
+    int round = 0;                ///< The round after the batch.
+    int progress = 0;             ///< Moves matched in that round after the batch.
+
+    /**
+     * @brief Returns true if the batch contained a wrong press.
+     */
+    bool lost() const { return mismatchIndex >= 0; }
+};
+
+#endif // PRESSBATCHRESULT_H
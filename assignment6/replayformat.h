@@ -0,0 +1,94 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * replayformat.h
+ *
+ * This file defines the binary replay journal format shared by the
+ * ReplayWriter and the ReplayReader.
+ *
+ * A journal starts with an 8 byte header: the 7 ASCII bytes "SIMONRJ"
+ * followed by one format version byte (1). After that come records, one
+ * after another, each starting with a tag byte and the time since the
+ * previous record of the journal in microseconds as a varint (LEB128, 7
+ * bits per byte, low bits first). A press is stamped with the time of its
+ * input event, and a Round or Lost record it causes with the same time;
+ * a record never goes back in time, so input older than the record before
+ * it gets a delta of 0. The records are:
+ *  - GameStart: varint colors, seed as 8 bytes little-endian.
+ *  - Sequence: varint move count, byte bits per move, then the packed
+ *    moves as 64-bit little-endian words (move i at bit i * bits).
+ *  - Round: varint round; the game has entered that round.
+ *  - Lost: no payload; the last press was wrong.
+ *  - Press: the pad index is stored in the low four bits of the tag.
+ *
+ * A typical press takes two bytes. Moves are a pure function of the seed,
+ * so a game needs no Sequence record to be replayed; it is there for
+ * journals that must not depend on the move generator.
+ */
+
+#ifndef REPLAYFORMAT_H
+#define REPLAYFORMAT_H
+
+#include <QtGlobal>
+
+namespace ReplayFormat {
+
+/// Identifies a journal file; the last byte is the format version.
+constexpr char Magic[] = { 'S', 'I', 'M', 'O', 'N', 'R', 'J', 1 };
+
+/// Length of the file header.
+constexpr int HeaderSize = sizeof(Magic);
+
+/// Longest encoding of a 64-bit varint.
+constexpr int MaxVarintBytes = 10;
+
+/// Record tags.
+enum Tag : quint8 {
+    GameStartTag = 0x01,
+    SequenceTag = 0x02,
+    RoundTag = 0x03,
+    LostTag = 0x04,
+    PressTag = 0x10, ///< Or'ed with the pad index, 0 to 15.
+    PressTagMask = 0xf0
+};
+
+/**
+ * @brief Writes a varint to a buffer with room for MaxVarintBytes.
+ * @param out Where to write.
+ * @param value The value to encode.
+ * @return The number of bytes written.
+ */
+inline int encodeVarint(uchar *out, quint64 value) {
+    int n = 0;
+    while (value >= 0x80) {
+        out[n++] = uchar(value) | 0x80;
+        value >>= 7;
+    }
+    out[n++] = uchar(value);
+    return n;
+}
+
+/**
+ * @brief Reads a varint.
+ * @param p Position to read from; advanced past the varint.
+ * @param end End of the readable bytes.
+ * @param value Receives the value.
+ * @return False if the varint is cut off or longer than 64 bits.
+ */
+inline bool decodeVarint(const uchar *&p, const uchar *end, quint64 &value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        const uchar byte = *p++;
+        value |= quint64(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+}
+
+#endif // REPLAYFORMAT_H
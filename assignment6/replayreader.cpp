@@ -0,0 +1,113 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * replayreader.cpp
+ *
+ * This file implements the ReplayReader class. Every length is checked
+ * against the end of the records before it is read, so a truncated or
+ * damaged journal stops the reader instead of reading past the mapping.
+ */
+
+#include "replayreader.h"
+#include "replayformat.h"
+#include <climits>
+#include <cstring>
+
+ReplayReader::ReplayReader()
+    : m_begin(nullptr),
+    m_end(nullptr),
+    m_pos(nullptr),
+    m_error(false)
+{
+}
+
+ReplayReader::ReplayReader(const uchar *records, qsizetype size)
+    : m_begin(records),
+    m_end(records + size),
+    m_pos(records),
+    m_error(false)
+{
+}
+
+ReplayReader::~ReplayReader() = default;
+
+bool ReplayReader::open(const QString &path) {
+    m_file = std::make_unique<QFile>(path);
+    m_begin = m_end = m_pos = nullptr;
+    m_error = false;
+    if (!m_file->open(QIODevice::ReadOnly) || m_file->size() < ReplayFormat::HeaderSize)
+        return false;
+    // The mapping lives as long as the file object.
+    const uchar *map = m_file->map(0, m_file->size());
+    if (!map || std::memcmp(map, ReplayFormat::Magic, ReplayFormat::HeaderSize) != 0)
+        return false;
+    m_begin = m_pos = map + ReplayFormat::HeaderSize;
+    m_end = map + m_file->size();
+    return true;
+}
+
+bool ReplayReader::next(Record &record) {
+    if (m_error || m_pos >= m_end)
+        return false;
+
+    const uchar *p = m_pos;
+    const quint8 tag = *p++;
+    quint64 value = 0;
+    bool ok = ReplayFormat::decodeVarint(p, m_end, record.deltaUs);
+
+    if (ok && (tag & ReplayFormat::PressTagMask) == ReplayFormat::PressTag) {
+        record.type = RecordType::Press;
+        record.pad = tag & ~ReplayFormat::PressTagMask;
+    } else if (ok) {
+        switch (tag) {
+        case ReplayFormat::GameStartTag:
+            record.type = RecordType::GameStart;
+            ok = ReplayFormat::decodeVarint(p, m_end, value) && value <= 16 && m_end - p >= 8;
+            if (ok) {
+                record.colors = int(value);
+                record.seed = qFromLittleEndian<quint64>(p);
+                p += 8;
+            }
+            break;
+        case ReplayFormat::SequenceTag: {
+            record.type = RecordType::Sequence;
+            ok = ReplayFormat::decodeVarint(p, m_end, value) && p < m_end;
+            if (!ok)
+                break;
+            const int bits = *p++;
+            // Check the length in words first so a huge count cannot overflow.
+            const quint64 words = value / 64 * quint64(bits) + (value % 64 * quint64(bits) + 63) / 64;
+            ok = bits >= 1 && bits <= 4 && words <= quint64(m_end - p) / 8;
+            if (ok) {
+                record.moveCount = qsizetype(value);
+                record.bitsPerMove = bits;
+                record.packed = p;
+                p += words * 8;
+            }
+            break;
+        }
+        case ReplayFormat::RoundTag:
+            record.type = RecordType::Round;
+            ok = ReplayFormat::decodeVarint(p, m_end, value) && value <= quint64(INT_MAX);
+            record.round = int(value);
+            break;
+        case ReplayFormat::LostTag:
+            record.type = RecordType::Lost;
+            break;
+        default:
+            ok = false;
+            break;
+        }
+    }
+
+    if (!ok) {
+        // Leave the position at the damaged record.
+        m_error = true;
+        return false;
+    }
+    m_pos = p;
+    return true;
+}
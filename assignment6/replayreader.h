@@ -0,0 +1,125 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * replayreader.h
+ *
+ * This file declares the ReplayReader class for the Simon game.
+ * The ReplayReader walks the records of a binary replay journal (see
+ * replayformat.h). A journal file is memory-mapped, and records are decoded
+ * straight from the mapping: nothing is copied, and the packed moves of a
+ * Sequence record point into the file.
+ *
+ * A reader can also walk any run of records already in memory, such as one
+ * shard of a mapped journal, which lets tools split a journal between
+ * threads at game boundaries.
+ *
+ * Usage:
+ *  - Call open() with a journal file, or construct the reader over records.
+ *  - Call next() until it returns false, then check hasError().
+ */
+
+#ifndef REPLAYREADER_H
+#define REPLAYREADER_H
+
+#include <QFile>
+#include <QString>
+#include <QtEndian>
+#include <memory>
+
+class ReplayReader {
+public:
+    /**
+     * @brief The kinds of records in a journal.
+     */
+    enum class RecordType {
+        GameStart, ///< A new game: colors and seed.
+        Sequence,  ///< The packed moves of the game.
+        Round,     ///< The game entered a round.
+        Press,     ///< A validated press.
+        Lost       ///< The last press was wrong.
+    };
+
+    /**
+     * @brief One decoded record; only the fields of its type are set.
+     */
+    struct Record {
+        RecordType type = RecordType::GameStart; ///< What the record is.
+        quint64 deltaUs = 0;                     ///< Microseconds since the previous record.
+        int colors = 0;                          ///< GameStart: number of colors.
+        quint64 seed = 0;                        ///< GameStart: seed of the moves.
+        int round = 0;                           ///< Round: the round entered.
+        int pad = 0;                             ///< Press: the pad's color index.
+        qsizetype moveCount = 0;                 ///< Sequence: number of moves.
+        int bitsPerMove = 0;                     ///< Sequence: bits per move.
+        const uchar *packed = nullptr;           ///< Sequence: little-endian words, inside the journal.
+
+        /**
+         * @brief Returns a word of a Sequence record's packed moves.
+         * @param i Index of the word; must be below (moveCount * bitsPerMove + 63) / 64.
+         */
+        quint64 word(qsizetype i) const { return qFromLittleEndian<quint64>(packed + i * 8); }
+    };
+
+    /**
+     * @brief Constructs a reader without records.
+     */
+    ReplayReader();
+
+    /**
+     * @brief Constructs a reader over records in memory, without a file header.
+     * @param records The first record; must stay valid while the reader is used.
+     * @param size Number of bytes of records.
+     */
+    ReplayReader(const uchar *records, qsizetype size);
+
+    ~ReplayReader();
+
+    ReplayReader(const ReplayReader &) = delete;
+    ReplayReader &operator=(const ReplayReader &) = delete;
+
+    /**
+     * @brief Maps a journal file and moves to its first record.
+     * @param path The journal file.
+     * @return False if the file cannot be mapped or is not a journal.
+     */
+    bool open(const QString &path);
+
+    /**
+     * @brief Decodes the next record.
+     * @param record Receives the record.
+     * @return False at the end of the records or at a damaged record.
+     */
+    bool next(Record &record);
+
+    /**
+     * @brief Returns true if next() stopped at a damaged or cut-off record.
+     */
+    bool hasError() const { return m_error; }
+
+    /**
+     * @brief Returns the first record byte.
+     */
+    const uchar *data() const { return m_begin; }
+
+    /**
+     * @brief Returns the number of record bytes.
+     */
+    qsizetype size() const { return m_end - m_begin; }
+
+    /**
+     * @brief Returns the offset of the next record from data().
+     */
+    qsizetype position() const { return m_pos - m_begin; }
+
+private:
+    std::unique_ptr<QFile> m_file; ///< The mapped journal, if the reader opened one.
+    const uchar *m_begin;          ///< First record byte.
+    const uchar *m_end;            ///< One past the last record byte.
+    const uchar *m_pos;            ///< Next record to decode.
+    bool m_error;                  ///< True after a damaged record.
+};
+
+#endif // REPLAYREADER_H
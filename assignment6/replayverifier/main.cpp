@@ -0,0 +1,85 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * main.cpp (replay verifier)
+ *
+ * The entry point of the headless replay verifier. It replays every game
+ * of the given journals against the Simon rules on all worker threads,
+ * prints the first mismatches and throughput numbers, and exits with 1 if
+ * any game does not check out or a journal is damaged.
+ *
+ * Example:
+ *   simonverify --threads 16 games-*.simonrj
+ */
+
+#include "verifier.h"
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QTextStream>
+#include <QThread>
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("simonverify");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Replays recorded Simon journals against the game rules on all cores.");
+    parser.addHelpOption();
+    QCommandLineOption threadsOption("threads", "Number of worker threads.", "count",
+                                     QString::number(QThread::idealThreadCount()));
+    parser.addOption(threadsOption);
+    parser.addPositionalArgument("journals", "Journal files written with --journal.", "journal...");
+    parser.process(app);
+
+    const QStringList journals = parser.positionalArguments();
+    if (journals.isEmpty())
+        parser.showHelp(1);
+
+    QTextStream out(stdout);
+    Verifier verifier(parser.value(threadsOption).toInt());
+    VerifyStats total;
+    qint64 elapsedNs = 0;
+    bool failed = false;
+
+    for (const QString &journal : journals) {
+        VerifyStats stats;
+        if (!verifier.verify(journal, stats)) {
+            QTextStream(stderr) << "Cannot read journal: " << journal << "\n";
+            failed = true;
+            continue;
+        }
+        elapsedNs += verifier.elapsedNs();
+        for (const VerifyMismatch &mismatch : std::as_const(stats.mismatches)) {
+            out << journal << ": ";
+            if (mismatch.game >= 0)
+                out << "game " << mismatch.game;
+            else
+                out << "before the first game";
+            out << " at byte " << mismatch.offset << ": " << mismatch.reason << "\n";
+        }
+        if (stats.mismatchedGames > stats.mismatches.size())
+            out << journal << ": " << stats.mismatchedGames - stats.mismatches.size() << " more mismatched games\n";
+        if (verifier.damaged()) {
+            out << journal << ": damaged record at byte " << verifier.damagedOffset()
+                << ", the rest of the journal was not verified\n";
+            failed = true;
+        }
+        failed = failed || !stats.mismatches.isEmpty();
+        total.merge(stats);
+    }
+
+    const double seconds = qMax(elapsedNs, qint64(1)) / 1e9;
+    out << "Replay verification: " << total.games << " games in " << journals.size() << " journals\n";
+    out << QString("  mismatched    : %1\n").arg(total.mismatchedGames);
+    out << QString("  lost          : %1\n").arg(total.lostGames);
+    out << QString("  rounds        : %1\n").arg(total.rounds);
+    out << QString("  presses       : %1\n").arg(total.presses);
+    out << QString("  wall time     : %1 s\n").arg(seconds, 0, 'f', 3);
+    out << QString("  games/min     : %1\n").arg(total.games / seconds * 60, 0, 'f', 0);
+    out << QString("  presses/sec   : %1\n").arg(total.presses / seconds, 0, 'f', 0);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,23 @@
+# Headless verifier that replays recorded journals against the Simon rules.
+# Built against QtCore only; no QApplication or widgets are involved.
+
+QT = core
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = simonverify
+
+include(../gamecore.pri)
+
+SOURCES += \
+    main.cpp \
+    verifier.cpp
+
+HEADERS += \
+    verifier.h
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
@@ -0,0 +1,257 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * verifier.cpp
+ *
+ * This file implements the Verifier class used by the headless replay
+ * verifier. Workers guess where their first game starts; a shard only
+ * counts if it started exactly where the shard before it stopped, and one
+ * that guessed wrong is replayed again from there. The shards share
+ * nothing but the read-only mapping, so workers run without any locking.
+ */
+
+#include "verifier.h"
+#include "replayformat.h"
+#include "replayreader.h"
+#include "simoncore.h"
+#include <QElapsedTimer>
+#include <QThreadPool>
+
+namespace {
+
+// Returns move i of a Sequence record.
+int recordedMove(const ReplayReader::Record &record, qsizetype i) {
+    const qsizetype offset = i * record.bitsPerMove;
+    const qsizetype word = offset >> 6;
+    const int shift = static_cast<int>(offset & 63);
+    quint64 bits = record.word(word) >> shift;
+    // The move straddles two words.
+    if (shift + record.bitsPerMove > 64)
+        bits |= record.word(word + 1) << (64 - shift);
+    return static_cast<int>(bits & ((quint64(1) << record.bitsPerMove) - 1));
+}
+
+}
+
+void VerifyStats::merge(const VerifyStats &other) {
+    const qint64 firstGame = games;
+    games += other.games;
+    mismatchedGames += other.mismatchedGames;
+    lostGames += other.lostGames;
+    rounds += other.rounds;
+    presses += other.presses;
+    records += other.records;
+    for (const VerifyMismatch &mismatch : other.mismatches) {
+        if (mismatches.size() >= Verifier::MaxReported)
+            break;
+        mismatches.append(mismatch);
+        // Records before the first game belong to none.
+        if (mismatch.game >= 0)
+            mismatches.last().game += firstGame;
+    }
+}
+
+Verifier::Verifier(int threads)
+    : m_threads(qMax(1, threads)),
+    m_damaged(false),
+    m_damagedOffset(0),
+    m_elapsedNs(0)
+{
+}
+
+bool Verifier::verify(const QString &path, VerifyStats &stats) {
+    QElapsedTimer timer;
+    timer.start();
+    m_damaged = false;
+    m_damagedOffset = 0;
+
+    ReplayReader reader;
+    if (!reader.open(path))
+        return false;
+
+    // Cut the records into equal byte ranges; the last one runs to the end.
+    const uchar *records = reader.data();
+    const qsizetype size = reader.size();
+    const qsizetype shards = qMax<qsizetype>(1, (size + ShardBytes - 1) / ShardBytes);
+    auto shardEnd = [size, shards](qsizetype i) { return i + 1 == shards ? size : (i + 1) * ShardBytes; };
+
+    QVector<VerifyShard> results(shards);
+    QThreadPool pool;
+    pool.setMaxThreadCount(m_threads);
+    for (qsizetype i = 0; i < shards; i++) {
+        pool.start([records, size, &shardEnd, &results, i]() {
+            // Only the first shard knows where its first record starts.
+            const qsizetype start = i == 0 ? 0 : findGameStart(records, size, i * ShardBytes);
+            results[i] = verifyShard(records, size, start, shardEnd(i));
+        });
+    }
+    pool.waitForDone();
+
+    // Merge in journal order so the reported mismatches are the first ones.
+    stats = VerifyStats();
+    qsizetype next = 0;
+    for (qsizetype i = 0; i < shards; i++) {
+        // A shard that started anywhere but where the one before it stopped
+        // synced on a tag byte inside another record.
+        if (results[i].start != next)
+            results[i] = verifyShard(records, size, next, shardEnd(i));
+        stats.merge(results[i].stats);
+        next = results[i].next;
+        // A damaged record ends the journal; everything before it is still replayed.
+        if (results[i].damaged) {
+            m_damaged = true;
+            m_damagedOffset = ReplayFormat::HeaderSize + next;
+            break;
+        }
+    }
+    m_elapsedNs = timer.nsecsElapsed();
+    return true;
+}
+
+qsizetype Verifier::findGameStart(const uchar *records, qsizetype size, qsizetype from) {
+    ReplayReader::Record record;
+    for (qsizetype p = from; p < size; p++) {
+        if (records[p] != ReplayFormat::GameStartTag)
+            continue;
+        // A real game start decodes to a game that enters round 1 next, as
+        // Model::startGame() journals it, possibly after its moves.
+        ReplayReader reader(records + p, size - p);
+        if (!reader.next(record) || record.type != ReplayReader::RecordType::GameStart
+            || record.colors < MinColors || record.colors > MaxColors)
+            continue;
+        bool more = reader.next(record);
+        while (more && record.type == ReplayReader::RecordType::Sequence)
+            more = reader.next(record);
+        if (more && record.type == ReplayReader::RecordType::Round && record.round == 1)
+            return p;
+    }
+    return size;
+}
+
+VerifyShard Verifier::verifyShard(const uchar *records, qsizetype size, qsizetype start, qsizetype end) {
+    VerifyShard shard;
+    shard.start = start;
+    VerifyStats &stats = shard.stats;
+    // Moves are regenerated from each game's seed, as the Model's Seeded mode does.
+    SimonCore<DynamicColors, SeededStorage> core;
+    ReplayReader reader(records + start, size - start);
+    ReplayReader::Record record;
+
+    qint64 game = -1;            // Index of the current game in the shard.
+    qint64 offset = 0;           // File offset of the current record.
+    bool inGame = false;         // True after the shard's first game start.
+    bool wrong = false;          // True after a wrong press in the current game.
+    bool lost = false;           // True after the current game's Lost record.
+    bool bad = false;            // True once the current game has a mismatch.
+    int completed = 0;           // Rounds completed in the current game.
+
+    auto mismatch = [&](const char *reason) {
+        // Report only the first thing wrong with a game; the rest follows from it.
+        if (bad)
+            return;
+        bad = true;
+        stats.mismatchedGames++;
+        if (stats.mismatches.size() < MaxReported)
+            stats.mismatches.append({ game, offset, reason });
+    };
+    auto endGame = [&]() {
+        if (!inGame)
+            return;
+        if (wrong && !lost)
+            mismatch("wrong press not recorded as a loss");
+        stats.games++;
+        stats.rounds += completed;
+        if (lost && !bad)
+            stats.lostGames++;
+    };
+
+    for (;;) {
+        const qsizetype position = start + reader.position();
+        offset = ReplayFormat::HeaderSize + position;
+        if (!reader.next(record)) {
+            // The reader stays at a damaged record.
+            shard.next = position;
+            shard.damaged = reader.hasError();
+            break;
+        }
+        // Games from the end of the range on belong to the next shard.
+        if (record.type == ReplayReader::RecordType::GameStart && position >= end) {
+            shard.next = position;
+            break;
+        }
+        stats.records++;
+
+        if (record.type == ReplayReader::RecordType::GameStart) {
+            endGame();
+            game++;
+            inGame = true;
+            wrong = lost = bad = false;
+            completed = 0;
+            if (record.colors < MinColors || record.colors > MaxColors) {
+                mismatch("color count out of range");
+                continue;
+            }
+            // The same reset and first round as Model::startGame().
+            core.setColorCount(record.colors);
+            core.start(record.seed);
+            continue;
+        }
+        if (!inGame) {
+            // Only the first shard can start before a game; the records belong to none.
+            if (stats.mismatches.isEmpty())
+                stats.mismatches.append({ -1, offset, "record before the first game start" });
+            continue;
+        }
+        if (bad)
+            continue;
+
+        switch (record.type) {
+        case ReplayReader::RecordType::Press:
+            if (wrong) {
+                mismatch("press after a wrong press");
+                break;
+            }
+            stats.presses++;
+            // Exactly what Model::press() and checkIsTrueButton() ask of the core.
+            switch (core.press(record.pad)) {
+            case PressOutcome::Progress:
+                break;
+            case PressOutcome::RoundComplete:
+                completed++;
+                break;
+            case PressOutcome::Wrong:
+                wrong = true;
+                break;
+            }
+            break;
+        case ReplayReader::RecordType::Round:
+            if (record.round != core.round())
+                mismatch("round does not match the replay");
+            break;
+        case ReplayReader::RecordType::Lost:
+            if (!wrong)
+                mismatch("loss recorded without a wrong press");
+            lost = true;
+            break;
+        case ReplayReader::RecordType::Sequence:
+            if (record.bitsPerMove != core.bitsPerMove()) {
+                mismatch("recorded moves have the wrong width");
+                break;
+            }
+            for (qsizetype i = 0; i < record.moveCount; i++) {
+                if (recordedMove(record, i) != CounterRng::moveAt(core.seed(), quint64(i), core.colorCount())) {
+                    mismatch("recorded moves differ from the seed");
+                    break;
+                }
+            }
+            break;
+        case ReplayReader::RecordType::GameStart:
+            break;
+        }
+    }
+    endGame();
+    return shard;
+}
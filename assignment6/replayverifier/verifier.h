@@ -0,0 +1,143 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * verifier.h
+ *
+ * This file declares the Verifier class used by the headless replay
+ * verifier. A Verifier maps a replay journal, cuts it into equal byte
+ * ranges and replays them on a QThreadPool. A worker starts at the first
+ * game start in its range and replays every game that starts inside it,
+ * finishing the last one past the range's end. Every worker owns a
+ * SimonCore that regenerates each game's moves from its seed and checks
+ * every recorded press exactly as the Model does for checkIsTrueButton()
+ * and press(). The claims the journal makes are compared with the replay:
+ *  - every Round record must name the round the replayed game is in,
+ *  - a Lost record must follow a wrong press, and a wrong press must be
+ *    recorded as a loss before the game ends,
+ *  - no press may follow a wrong one in the same game,
+ *  - recorded packed moves must match the moves drawn from the seed.
+ *
+ * Shards are read straight from the mapping, and the cores use
+ * SeededStorage, so replaying does not allocate.
+ */
+
+#ifndef VERIFIER_H
+#define VERIFIER_H
+
+#include <QString>
+#include <QVector>
+
+/**
+ * @brief The first thing wrong with one game.
+ */
+struct VerifyMismatch {
+    qint64 game = 0;              ///< Index of the game in the journal, from 0.
+    qint64 offset = 0;            ///< Byte offset of the offending record in the file.
+    const char *reason = nullptr; ///< What the replay disagrees with.
+};
+
+/**
+ * @brief Counters collected by the workers.
+ *
+ * Game indices of the mismatches count from the first game of the shard
+ * the counters belong to, until merge() adds them to the earlier shards.
+ */
+struct VerifyStats {
+    qint64 games = 0;          ///< Games replayed.
+    qint64 mismatchedGames = 0; ///< Games with at least one mismatch.
+    qint64 lostGames = 0;      ///< Games that ended in a verified loss.
+    qint64 rounds = 0;         ///< Rounds completed over all games.
+    qint64 presses = 0;        ///< Presses replayed.
+    qint64 records = 0;        ///< Records read.
+    QVector<VerifyMismatch> mismatches; ///< The first mismatches, in journal order.
+
+    /**
+     * @brief Adds the counters of the shard after this one.
+     * @param other The counters to add; its game indices follow the games counted here.
+     */
+    void merge(const VerifyStats &other);
+};
+
+/**
+ * @brief What a worker found in its byte range of the journal.
+ */
+struct VerifyShard {
+    VerifyStats stats;    ///< The counters of the games that start in the range.
+    qsizetype start = 0;  ///< Offset of the record the worker started at.
+    qsizetype next = 0;   ///< Offset of the first game start at or after the range's end, or of the end of the records.
+    bool damaged = false; ///< True if a damaged record at next stopped the worker.
+};
+
+class Verifier {
+public:
+    /// Bytes of the journal in each range handed to a worker.
+    static constexpr qsizetype ShardBytes = 1024 * 1024;
+
+    /// Mismatches kept for the report; the rest are only counted.
+    static constexpr int MaxReported = 100;
+
+    /**
+     * @brief Constructs a verifier.
+     * @param threads Number of worker threads of the pool.
+     */
+    explicit Verifier(int threads);
+
+    /**
+     * @brief Replays every game of a journal and blocks until all shards are done.
+     * @param path The journal file.
+     * @param stats Receives the merged counters.
+     * @return False if the journal cannot be mapped.
+     */
+    bool verify(const QString &path, VerifyStats &stats);
+
+    /**
+     * @brief Returns true if the last journal ended in a damaged or cut-off record.
+     *
+     * Games before that record are still verified.
+     */
+    bool damaged() const { return m_damaged; }
+
+    /**
+     * @brief Returns the byte offset of the damaged record of the last journal.
+     */
+    qint64 damagedOffset() const { return m_damagedOffset; }
+
+    /**
+     * @brief Returns the wall-clock duration of the last verify(), in nanoseconds.
+     */
+    qint64 elapsedNs() const { return m_elapsedNs; }
+
+    /**
+     * @brief Returns the offset of the first record at or after an offset that looks like a game start.
+     *
+     * The GameStart tag byte also occurs inside other records, so the
+     * result is only a guess; verify() checks it against the shard before.
+     *
+     * @param records The first record of the journal.
+     * @param size Number of bytes of records.
+     * @param from Where to start looking.
+     * @return The offset, or size if there is none.
+     */
+    static qsizetype findGameStart(const uchar *records, qsizetype size, qsizetype from);
+
+    /**
+     * @brief Replays the games that start in a byte range of the journal.
+     * @param records The first record of the journal.
+     * @param size Number of bytes of records.
+     * @param start Offset of a record boundary to start at: 0 or a game start.
+     * @param end Games that start at or after this offset are left to the next shard.
+     * @return The counters of the shard and where the next shard must start.
+     */
+    static VerifyShard verifyShard(const uchar *records, qsizetype size, qsizetype start, qsizetype end);
+
+private:
+    int m_threads;          ///< Number of worker threads.
+    bool m_damaged;         ///< True if the last journal ended in a damaged record.
+    qint64 m_damagedOffset; ///< File offset of that record.
+    qint64 m_elapsedNs;     ///< Duration of the last verify().
+};
+
+#endif // VERIFIER_H
@@ -0,0 +1,156 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * replaywriter.cpp
+ *
+ * This file implements the ReplayWriter class. A record is encoded in
+ * place at the end of the buffer: the buffer grows by the largest size the
+ * record can have and is cut back to the bytes actually used. The file
+ * always ends on a complete record: a cut-off tail is truncated when the
+ * journal is opened and after a failed write.
+ */
+
+#include "replaywriter.h"
+#include "gameclock.h"
+#include "replayformat.h"
+#include "replayreader.h"
+#include <QDebug>
+#include <QtEndian>
+
+namespace {
+
+// Returns the size of a journal up to the end of its last complete record, or -1.
+qint64 completeSize(const QString &path) {
+    ReplayReader reader;
+    if (!reader.open(path))
+        return -1;
+    ReplayReader::Record record;
+    // The reader stops in front of a damaged or cut-off record.
+    while (reader.next(record)) {
+    }
+    return ReplayFormat::HeaderSize + reader.position();
+}
+
+}
+
+ReplayWriter::ReplayWriter()
+    : m_lastUs(0)
+{
+    m_buffer.reserve(BufferBytes + 64);
+}
+
+ReplayWriter::~ReplayWriter() {
+    flush();
+}
+
+bool ReplayWriter::open(const QString &path) {
+    flush();
+    m_file.close();
+    m_file.setFileName(path);
+    // Records are already buffered here; a failed write must not leave bytes behind in QFile.
+    if (!m_file.open(QIODevice::ReadWrite | QIODevice::Unbuffered))
+        return false;
+    if (m_file.size() == 0) {
+        m_file.write(ReplayFormat::Magic, ReplayFormat::HeaderSize);
+    } else if (m_file.read(ReplayFormat::HeaderSize)
+               != QByteArray(ReplayFormat::Magic, ReplayFormat::HeaderSize)) {
+        // Never append to something that is not a journal of this version.
+        m_file.close();
+        return false;
+    } else {
+        // A run killed in the middle of a flush leaves a cut-off record at the
+        // end; readers stop there, so nothing appended after it could be read.
+        const qint64 complete = completeSize(path);
+        if (complete < 0) {
+            m_file.close();
+            return false;
+        }
+        if (complete < m_file.size()) {
+            qWarning().noquote() << "Dropped a cut-off record at the end of the journal" << path;
+            if (!m_file.resize(complete)) {
+                m_file.close();
+                return false;
+            }
+        }
+    }
+    // Records are only ever appended.
+    return m_file.seek(m_file.size());
+}
+
+uchar *ReplayWriter::beginRecord(quint8 tag, int payload, qint64 timeUs) {
+    const qsizetype start = m_buffer.size();
+    m_buffer.resize(start + 1 + ReplayFormat::MaxVarintBytes + payload);
+    uchar *p = reinterpret_cast<uchar*>(m_buffer.data()) + start;
+    *p++ = tag;
+    if (timeUs < 0)
+        timeUs = SystemClock::instance()->nowUs();
+    // Input is validated after it happened, possibly after a later record.
+    timeUs = qMax(timeUs, m_lastUs);
+    p += ReplayFormat::encodeVarint(p, quint64(timeUs - m_lastUs));
+    m_lastUs = timeUs;
+    return p;
+}
+
+void ReplayWriter::endRecord(uchar *end) {
+    m_buffer.resize(end - reinterpret_cast<uchar*>(m_buffer.data()));
+    if (m_buffer.size() >= BufferBytes)
+        flush();
+}
+
+void ReplayWriter::gameStarted(int colors, quint64 seed) {
+    uchar *p = beginRecord(ReplayFormat::GameStartTag, ReplayFormat::MaxVarintBytes + 8);
+    p += ReplayFormat::encodeVarint(p, quint64(colors));
+    qToLittleEndian(seed, p);
+    endRecord(p + 8);
+}
+
+void ReplayWriter::sequence(MoveSequenceView moves) {
+    const qsizetype words = (moves.size() * moves.bitsPerMove() + 63) / 64;
+    uchar *p = beginRecord(ReplayFormat::SequenceTag, ReplayFormat::MaxVarintBytes + 1 + words * 8);
+    p += ReplayFormat::encodeVarint(p, quint64(moves.size()));
+    *p++ = uchar(moves.bitsPerMove());
+    for (qsizetype i = 0; i < words; i++, p += 8)
+        qToLittleEndian(moves.words()[i], p);
+    endRecord(p);
+}
+
+void ReplayWriter::roundStarted(int round, qint64 timeUs) {
+    uchar *p = beginRecord(ReplayFormat::RoundTag, ReplayFormat::MaxVarintBytes, timeUs);
+    p += ReplayFormat::encodeVarint(p, quint64(round));
+    endRecord(p);
+}
+
+void ReplayWriter::pressed(int pad, qint64 timeUs) {
+    Q_ASSERT(pad >= 0 && pad < 16);
+    endRecord(beginRecord(quint8(ReplayFormat::PressTag | pad), 0, timeUs));
+}
+
+void ReplayWriter::lost(qint64 timeUs) {
+    endRecord(beginRecord(ReplayFormat::LostTag, 0, timeUs));
+}
+
+bool ReplayWriter::flush() {
+    if (m_buffer.isEmpty())
+        return true;
+    if (!m_file.isOpen()) {
+        // Without a file there is nowhere to keep the records.
+        m_buffer.clear();
+        return false;
+    }
+    const qint64 complete = m_file.size();
+    const bool ok = m_file.write(m_buffer) == m_buffer.size() && m_file.flush();
+    // clear() would give up the capacity; keep it for the next block.
+    m_buffer.resize(0);
+    if (!ok) {
+        // Records appended after a partial block could never be read back; cut the
+        // block off and stop journaling.
+        qWarning().noquote() << "Could not write the journal" << m_file.fileName()
+                             << "- journaling stopped:" << m_file.errorString();
+        m_file.resize(complete);
+        m_file.close();
+    }
+    return ok;
+}
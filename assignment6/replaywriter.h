@@ -0,0 +1,129 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * replaywriter.h
+ *
+ * This file declares the ReplayWriter class for the Simon game.
+ * The ReplayWriter appends games to a binary replay journal (see
+ * replayformat.h): the seed each game starts from, every press the Model
+ * validates and every round boundary, each stamped with the time since the
+ * previous record on SystemClock::instance(); a press carries the time of
+ * its input event. Records are encoded into a memory buffer and written to
+ * the end of the file in large blocks, so recording a press is a few byte
+ * stores.
+ *
+ * Usage:
+ *  - Call open() with the journal file; new records go after the old ones.
+ *    A record cut off by a run that died while writing is dropped first.
+ *  - Attach it to the Model with Model::setJournal().
+ *  - Call flush() to force the buffer out; the destructor flushes too.
+ */
+
+#ifndef REPLAYWRITER_H
+#define REPLAYWRITER_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+#include "movesequence.h"
+
+class ReplayWriter {
+public:
+    /// Bytes buffered before they are written to the file.
+    static constexpr qsizetype BufferBytes = 64 * 1024;
+
+    /**
+     * @brief Constructs a writer without a file.
+     */
+    ReplayWriter();
+
+    /**
+     * @brief Flushes the buffered records.
+     */
+    ~ReplayWriter();
+
+    ReplayWriter(const ReplayWriter &) = delete;
+    ReplayWriter &operator=(const ReplayWriter &) = delete;
+
+    /**
+     * @brief Opens a journal for appending; an empty or new file gets the header.
+     *
+     * A cut-off record at the end of the file is truncated away, so the new
+     * records stay readable.
+     *
+     * @param path The journal file.
+     * @return False if the file cannot be opened or is not a journal.
+     */
+    bool open(const QString &path);
+
+    /**
+     * @brief Returns true if records are written to a file.
+     */
+    bool isOpen() const { return m_file.isOpen(); }
+
+    /**
+     * @brief Records the start of a game.
+     * @param colors The number of colors of the game.
+     * @param seed The seed the game's moves are drawn from.
+     */
+    void gameStarted(int colors, quint64 seed);
+
+    /**
+     * @brief Records the packed moves of the game explicitly.
+     * @param moves The moves; they are copied into the journal.
+     */
+    void sequence(MoveSequenceView moves);
+
+    /**
+     * @brief Records that the game has entered a round.
+     * @param round The round number, from 1.
+     * @param timeUs When the round started, from SystemClock::nowUs(); -1 for now.
+     */
+    void roundStarted(int round, qint64 timeUs = -1);
+
+    /**
+     * @brief Records a validated press.
+     * @param pad The pad's color index, 0 to 15.
+     * @param timeUs Time of the input event, from SystemClock::nowUs(); -1 for now.
+     */
+    void pressed(int pad, qint64 timeUs = -1);
+
+    /**
+     * @brief Records that the game was lost.
+     * @param timeUs Time of the wrong press, from SystemClock::nowUs(); -1 for now.
+     */
+    void lost(qint64 timeUs = -1);
+
+    /**
+     * @brief Writes the buffered records to the file.
+     * If the write fails, the partial block is truncated away and the journal
+     * is closed; later records are dropped.
+     *
+     * @return False if the write failed.
+     */
+    bool flush();
+
+private:
+    /**
+     * @brief Starts a record with its tag and time delta, leaving room for a payload.
+     * @param tag The record tag.
+     * @param payload Largest payload the record will append.
+     * @param timeUs Time of the record, from SystemClock::nowUs(); -1 for now.
+     * @return Where the payload goes.
+     */
+    uchar *beginRecord(quint8 tag, int payload, qint64 timeUs = -1);
+
+    /**
+     * @brief Ends a record whose payload ends at the given position.
+     */
+    void endRecord(uchar *end);
+
+    QFile m_file;          ///< The journal file, opened for appending.
+    QByteArray m_buffer;   ///< Encoded records not written yet.
+    qint64 m_lastUs;       ///< Time of the previous record in microseconds.
+};
+
+#endif // REPLAYWRITER_H
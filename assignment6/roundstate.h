@@ -0,0 +1,45 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * roundstate.h
+ *
+ * This file declares the RoundState delta the Model emits whenever the
+ * round or the player's progress changes. One emission carries everything
+ * that changed, flagged in a bit mask, together with a version that grows
+ * with every emission, so a view can apply a whole round transition in a
+ * single pass and receivers can tell stale or skipped updates apart.
+ */
+
+#ifndef ROUNDSTATE_H
+#define ROUNDSTATE_H
+
+#include <QMetaType>
+#include <QtGlobal>
+
+struct RoundState {
+    /**
+     * @brief Fields that can change in one delta.
+     */
+    enum Field {
+        RoundField = 0x1,    ///< The round number changed.
+        ProgressField = 0x2, ///< The number of matched moves changed.
+        StartedField = 0x4   ///< A new round started and its playback is about to begin.
+    };
+
+    quint64 version = 0; ///< Increases by one with every emission of the Model.
+    int changed = 0;     ///< Bit mask of the Fields that changed.
+    int round = 0;       ///< The current round, which is also the number of moves in it.
+    int progress = 0;    ///< The number of moves the player has matched in this round.
+
+    /**
+     * @brief Returns true if the given field changed in this delta.
+     */
+    bool has(Field field) const { return (changed & field) != 0; }
+};
+
+Q_DECLARE_METATYPE(RoundState)
+
+#endif // ROUNDSTATE_H
@@ -0,0 +1,138 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * shadowcache.cpp
+ *
+ * This file implements the ShadowCache. The blur is three passes of a
+ * separable box blur over the alpha of the mask, which is close to the
+ * Gaussian blur of QGraphicsDropShadowEffect and runs once per shape.
+ */
+
+#include "shadowcache.h"
+#include <QImage>
+#include <QPainter>
+#include <QVector>
+#include <QtMath>
+#include <algorithm>
+
+namespace {
+
+// Blurs one line of alpha values in place with a box of the given half width.
+void boxBlurLine(quint8 *line, int count, int stride, int radius, QVector<int> &scratch) {
+    scratch.resize(count);
+    for (int i = 0; i < count; i++)
+        scratch[i] = line[i * stride];
+
+    const int window = 2 * radius + 1;
+    int sum = 0;
+    // Pixels outside the image count as transparent.
+    for (int i = 0; i <= radius && i < count; i++)
+        sum += scratch[i];
+    for (int i = 0; i < count; i++) {
+        line[i * stride] = static_cast<quint8>(sum / window);
+        int enter = i + radius + 1;
+        int leave = i - radius;
+        if (enter < count)
+            sum += scratch[enter];
+        if (leave >= 0)
+            sum -= scratch[leave];
+    }
+}
+
+// Approximates a Gaussian blur of the alpha plane with three box passes per direction.
+void blurAlpha(QVector<quint8> &alpha, int width, int height, int radius) {
+    if (radius <= 0)
+        return;
+    QVector<int> scratch;
+    for (int pass = 0; pass < 3; pass++) {
+        for (int y = 0; y < height; y++)
+            boxBlurLine(alpha.data() + y * width, width, 1, radius, scratch);
+        for (int x = 0; x < width; x++)
+            boxBlurLine(alpha.data() + x, height, width, radius, scratch);
+    }
+}
+
+}
+
+ShadowCache::ShadowCache()
+    : m_blurRadius(10),
+    m_offset(3, 3),
+    m_color(0, 0, 0, 150)
+{
+}
+
+void ShadowCache::setBlurRadius(int radius) {
+    m_blurRadius = qMax(0, radius);
+    clear();
+}
+
+void ShadowCache::setColor(const QColor &color) {
+    m_color = color;
+    clear();
+}
+
+QPixmap ShadowCache::shadow(const QSize &size, int cornerRadius, qreal devicePixelRatio) {
+    Key key = { size.width(), size.height(), cornerRadius,
+                qRound(devicePixelRatio * 1000) };
+    auto it = m_cache.constFind(key);
+    if (it != m_cache.constEnd())
+        return it.value();
+    QPixmap pixmap = render(size, cornerRadius, devicePixelRatio);
+    m_cache.insert(key, pixmap);
+    return pixmap;
+}
+
+QPoint ShadowCache::shadowOrigin(const QPoint &buttonPos) const {
+    return buttonPos + m_offset - QPoint(m_blurRadius, m_blurRadius);
+}
+
+QRect ShadowCache::shadowRect(const QRect &buttonGeometry) const {
+    return buttonGeometry.translated(m_offset).adjusted(-m_blurRadius, -m_blurRadius,
+                                                        m_blurRadius, m_blurRadius);
+}
+
+QPixmap ShadowCache::render(const QSize &size, int cornerRadius, qreal devicePixelRatio) const {
+    // Work in device pixels so the shadow stays sharp on high-DPI screens.
+    const int margin = qCeil(m_blurRadius * devicePixelRatio);
+    const int width = qCeil(size.width() * devicePixelRatio) + 2 * margin;
+    const int height = qCeil(size.height() * devicePixelRatio) + 2 * margin;
+    if (width <= 0 || height <= 0)
+        return QPixmap();
+
+    // Draw the button's shape as an opaque mask.
+    QImage mask(width, height, QImage::Format_Alpha8);
+    mask.fill(0);
+    {
+        QPainter painter(&mask);
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setPen(Qt::NoPen);
+        painter.setBrush(Qt::black);
+        qreal radius = cornerRadius * devicePixelRatio;
+        painter.drawRoundedRect(QRectF(margin, margin, width - 2 * margin, height - 2 * margin),
+                                radius, radius);
+    }
+
+    // Blur the mask; the box half width matches the Gaussian of the live effect.
+    QVector<quint8> alpha(width * height);
+    for (int y = 0; y < height; y++) {
+        const uchar *line = mask.constScanLine(y);
+        std::copy(line, line + width, alpha.begin() + y * width);
+    }
+    blurAlpha(alpha, width, height, qRound(m_blurRadius * devicePixelRatio / 2));
+
+    // Tint the blurred mask with the shadow color.
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    const int baseAlpha = m_color.alpha();
+    for (int y = 0; y < height; y++) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < width; x++) {
+            int a = alpha[y * width + x] * baseAlpha / 255;
+            line[x] = qPremultiply(qRgba(m_color.red(), m_color.green(), m_color.blue(), a));
+        }
+    }
+    image.setDevicePixelRatio(devicePixelRatio);
+    return QPixmap::fromImage(image);
+}
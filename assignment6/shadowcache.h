@@ -0,0 +1,123 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * shadowcache.h
+ *
+ * This file declares the ShadowCache used to draw drop shadows under the
+ * buttons of the Simon board. A shadow is a rounded-rectangle mask of the
+ * button's shape, blurred once per size and device pixel ratio and kept as
+ * a pixmap, so drawing it while a button flashes or moves is a single
+ * pixmap blit instead of an offscreen render plus blur on every repaint.
+ *
+ * Usage:
+ *  - Configure the blur radius, offset and color once.
+ *  - Call shadow() at paint time and draw the pixmap at shadowOrigin().
+ */
+
+#ifndef SHADOWCACHE_H
+#define SHADOWCACHE_H
+
+#include <QColor>
+#include <QHash>
+#include <QPixmap>
+#include <QPoint>
+#include <QRect>
+#include <QSize>
+
+class ShadowCache {
+public:
+    /**
+     * @brief Constructs a cache with the same look as a QGraphicsDropShadowEffect
+     *        with blur radius 10, offset (3, 3) and a translucent black color.
+     */
+    ShadowCache();
+
+    /**
+     * @brief Sets the blur radius in device-independent pixels and clears the cache.
+     */
+    void setBlurRadius(int radius);
+
+    /**
+     * @brief Returns the blur radius in device-independent pixels.
+     */
+    int blurRadius() const { return m_blurRadius; }
+
+    /**
+     * @brief Sets the offset of the shadow relative to its button.
+     */
+    void setOffset(const QPoint &offset) { m_offset = offset; }
+
+    /**
+     * @brief Returns the offset of the shadow relative to its button.
+     */
+    QPoint offset() const { return m_offset; }
+
+    /**
+     * @brief Sets the shadow color and clears the cache.
+     */
+    void setColor(const QColor &color);
+
+    /**
+     * @brief Returns the shadow color.
+     */
+    QColor color() const { return m_color; }
+
+    /**
+     * @brief Returns the blurred shadow for a button, rendering it on first use.
+     * @param size Size of the button in device-independent pixels.
+     * @param cornerRadius Corner radius of the button's shape.
+     * @param devicePixelRatio Device pixel ratio of the target surface.
+     * @return A pixmap larger than the button by the blur radius on every side.
+     */
+    QPixmap shadow(const QSize &size, int cornerRadius, qreal devicePixelRatio);
+
+    /**
+     * @brief Returns where to draw the shadow of a button placed at the given position.
+     */
+    QPoint shadowOrigin(const QPoint &buttonPos) const;
+
+    /**
+     * @brief Returns the area covered by the shadow of a button with the given geometry.
+     */
+    QRect shadowRect(const QRect &buttonGeometry) const;
+
+    /**
+     * @brief Drops every cached shadow.
+     */
+    void clear() { m_cache.clear(); }
+
+private:
+    /**
+     * @brief Identifies one cached shadow.
+     */
+    struct Key {
+        int width;
+        int height;
+        int cornerRadius;
+        int dprPermille; ///< Device pixel ratio times 1000.
+
+        bool operator==(const Key &other) const {
+            return width == other.width && height == other.height
+                   && cornerRadius == other.cornerRadius && dprPermille == other.dprPermille;
+        }
+    };
+
+    friend size_t qHash(const Key &key, size_t seed) {
+        return qHashMulti(seed, key.width, key.height, key.cornerRadius, key.dprPermille);
+    }
+
+    /**
+     * @brief Renders and blurs the shadow of one button shape.
+     */
+    QPixmap render(const QSize &size, int cornerRadius, qreal devicePixelRatio) const;
+
+    int m_blurRadius;            ///< Blur radius in device-independent pixels.
+    QPoint m_offset;             ///< Offset of the shadow relative to its button.
+    QColor m_color;              ///< Color of the shadow.
+    QHash<Key, QPixmap> m_cache; ///< Rendered shadows by size, shape and pixel ratio.
+};
+
+#endif // SHADOWCACHE_H
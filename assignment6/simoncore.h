@@ -0,0 +1,425 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * simoncore.h
+ *
+ * This file declares SimonCore, the rules of the Simon game as a plain,
+ * header-only C++ class. It has no QObject, no signals and no moc: every
+ * call returns its outcome directly, so simulations and servers can inline
+ * the rules in a tight loop. The Model is a thin Qt adapter that turns the
+ * outcomes into signals for the view.
+ *
+ * SimonCore is templated on:
+ *  - Colors: the number of colors, fixed at compile time (2 to 16) or
+ *    DynamicColors to choose it at run time with setColorCount().
+ *  - Storage: how the moves are kept. PackedStorage packs them into a
+ *    MoveSequence, SeededStorage keeps nothing and recomputes every move
+ *    from the seed, and SwitchableStorage picks one of the two at run time.
+ *
+ * Usage:
+ *  - SimonCore<2, PackedStorage> core; core.start(seed);
+ *  - Call press() for every press and act on the returned PressOutcome.
+ *  - pressBatch() validates a burst of presses a word at a time.
+ */
+
+#ifndef SIMONCORE_H
+#define SIMONCORE_H
+
+#include <QtGlobal>
+#include <QtAlgorithms>
+#include <cmath> // for std::pow
+#include "counterrng.h"
+#include "movesequence.h"
+#include "padcolor.h"
+#include "playbackround.h"
+#include "pressbatchresult.h"
+
+/// Colors argument of SimonCore for a color count chosen at run time.
+constexpr int DynamicColors = 0;
+
+/**
+ * @brief How the sequence of moves is kept in memory.
+ */
+enum class SequenceMode {
+    Stored, ///< Moves are kept bit-packed; reads are a bit lookup.
+    Seeded  ///< Only the seed and length are kept; moves are recomputed.
+};
+
+/**
+ * @brief The result of a single press.
+ */
+enum class PressOutcome {
+    Progress,      ///< The press was correct and the round goes on.
+    RoundComplete, ///< The press completed the round; the next round has started.
+    Wrong          ///< The press was wrong; the game is lost.
+};
+
+/**
+ * @brief Storage policy that keeps the moves bit-packed.
+ */
+class PackedStorage {
+public:
+    /**
+     * @brief Drops all moves and sets the bits each move takes.
+     */
+    void reset(int bitsPerMove) { m_moves = MoveSequence(bitsPerMove); }
+
+    /**
+     * @brief Drops all moves, keeping the reserved storage.
+     */
+    void clear() { m_moves.clear(); }
+
+    /**
+     * @brief Stores the next move.
+     */
+    void append(int move) { m_moves.append(move); }
+
+    /**
+     * @brief Returns true if moves are recomputed from the seed instead of stored.
+     */
+    bool isSeeded() const { return false; }
+
+    /**
+     * @brief Returns the move at an index.
+     */
+    int at(quint64, qsizetype index, int) const { return m_moves.at(index); }
+
+    /**
+     * @brief Returns consecutive moves packed into one word.
+     */
+    quint64 packedAt(quint64, qsizetype index, int count, int) const {
+        return m_moves.view().packedAt(index, count);
+    }
+
+    /**
+     * @brief Returns a view of the stored moves.
+     */
+    MoveSequenceView view() const { return m_moves.view(); }
+
+    /**
+     * @brief Returns a playback snapshot sharing the stored moves.
+     */
+    PlaybackRound playback(quint64, int, qsizetype, int round, int stepMs) const {
+        return PlaybackRound(m_moves, round, stepMs);
+    }
+
+private:
+    MoveSequence m_moves; ///< The packed moves.
+};
+
+/**
+ * @brief Storage policy that keeps nothing and recomputes every move from the seed.
+ */
+class SeededStorage {
+public:
+    void reset(int) {}
+    void clear() {}
+    void append(int) {}
+    bool isSeeded() const { return true; }
+
+    int at(quint64 seed, qsizetype index, int colors) const {
+        return CounterRng::moveAt(seed, static_cast<quint64>(index), colors);
+    }
+
+    quint64 packedAt(quint64 seed, qsizetype index, int count, int colors) const {
+        // Build the word from the generator.
+        const int bits = MoveSequence::bitsForColors(colors);
+        quint64 packed = 0;
+        for (int i = 0; i < count; i++)
+            packed |= quint64(at(seed, index + i, colors)) << (i * bits);
+        return packed;
+    }
+
+    MoveSequenceView view() const { return MoveSequenceView(); }
+
+    PlaybackRound playback(quint64 seed, int colors, qsizetype size, int round, int stepMs) const {
+        return PlaybackRound(seed, colors, size, round, stepMs);
+    }
+};
+
+/**
+ * @brief Storage policy that switches between PackedStorage and SeededStorage at run time.
+ *
+ * Used by the Model, whose sequence mode can change during a game. Call
+ * SimonCore::repack() after setMode() so the stored moves match.
+ */
+class SwitchableStorage {
+public:
+    /**
+     * @brief Returns how the moves are kept.
+     */
+    SequenceMode mode() const { return m_mode; }
+
+    /**
+     * @brief Sets how the moves are kept; the core must be repacked afterwards.
+     */
+    void setMode(SequenceMode mode) { m_mode = mode; }
+
+    void reset(int bitsPerMove) { m_packed.reset(bitsPerMove); }
+    void clear() { m_packed.clear(); }
+
+    void append(int move) {
+        if (m_mode == SequenceMode::Stored)
+            m_packed.append(move);
+    }
+
+    bool isSeeded() const { return m_mode == SequenceMode::Seeded; }
+
+    int at(quint64 seed, qsizetype index, int colors) const {
+        return isSeeded() ? m_seeded.at(seed, index, colors) : m_packed.at(seed, index, colors);
+    }
+
+    quint64 packedAt(quint64 seed, qsizetype index, int count, int colors) const {
+        return isSeeded() ? m_seeded.packedAt(seed, index, count, colors)
+                          : m_packed.packedAt(seed, index, count, colors);
+    }
+
+    MoveSequenceView view() const { return m_packed.view(); }
+
+    PlaybackRound playback(quint64 seed, int colors, qsizetype size, int round, int stepMs) const {
+        return isSeeded() ? m_seeded.playback(seed, colors, size, round, stepMs)
+                          : m_packed.playback(seed, colors, size, round, stepMs);
+    }
+
+private:
+    SequenceMode m_mode = SequenceMode::Stored; ///< The active policy.
+    PackedStorage m_packed;                     ///< Moves kept in Stored mode.
+    SeededStorage m_seeded;                     ///< Stateless policy for Seeded mode.
+};
+
+template <int Colors = DynamicColors, typename Storage = PackedStorage>
+class SimonCore {
+    static_assert(Colors == DynamicColors || (Colors >= MinColors && Colors <= MaxColors),
+                  "Colors must be DynamicColors or in [MinColors, MaxColors]");
+
+public:
+    /// True if the number of colors is chosen at run time.
+    static constexpr bool HasDynamicColors = Colors == DynamicColors;
+
+    /**
+     * @brief Returns the time between the start of two consecutive flashes of a round.
+     * @param round The round number.
+     * @return 1000 * 0.9^round milliseconds.
+     */
+    static int stepMsForRound(int round) {
+        return static_cast<int>(1000 * std::pow(0.9, round));
+    }
+
+    /**
+     * @brief Constructs a core with no game in progress.
+     * @param seed The seed of the first game.
+     */
+    explicit SimonCore(quint64 seed = 0)
+        : m_seed(seed) {
+        m_storage.reset(bitsPerMove());
+    }
+
+    /**
+     * @brief Returns the number of colors in the game.
+     */
+    int colorCount() const { return HasDynamicColors ? m_colors : Colors; }
+
+    /**
+     * @brief Returns the number of bits each packed move takes.
+     */
+    int bitsPerMove() const { return MoveSequence::bitsForColors(colorCount()); }
+
+    /**
+     * @brief Sets the number of colors and abandons the game in progress.
+     *
+     * Only available with DynamicColors.
+     *
+     * @param colors Number of colors, clamped to [MinColors, MaxColors].
+     * @return True if the number of colors changed.
+     */
+    bool setColorCount(int colors) {
+        static_assert(HasDynamicColors, "setColorCount() needs DynamicColors");
+        colors = qBound(MinColors, colors, MaxColors);
+        if (colors == m_colors)
+            return false;
+        m_colors = colors;
+        // Moves of the old game do not fit the new board; start over with wider or narrower moves.
+        m_round = 0;
+        m_userIndex = 0;
+        m_storage.reset(bitsPerMove());
+        return true;
+    }
+
+    /**
+     * @brief Returns the current round, which is also the length of the sequence.
+     */
+    int round() const { return m_round; }
+
+    /**
+     * @brief Returns the index of the next move the player needs to match.
+     */
+    int userIndex() const { return m_userIndex; }
+
+    /**
+     * @brief Returns the seed of the current game.
+     */
+    quint64 seed() const { return m_seed; }
+
+    /**
+     * @brief Returns the move at the given index of the sequence.
+     * @param index Index of the move; must be in [0, round()).
+     * @return The color index of the move, in [0, colorCount()).
+     */
+    int moveAt(qsizetype index) const {
+        Q_ASSERT(index >= 0 && index < m_round);
+        return m_storage.at(m_seed, index, colorCount());
+    }
+
+    /**
+     * @brief Returns consecutive moves of the sequence packed into one word.
+     * @param index Index of the first move.
+     * @param count Number of moves, at most as many as fit in one word.
+     */
+    quint64 packedAt(qsizetype index, int count) const {
+        return m_storage.packedAt(m_seed, index, count, colorCount());
+    }
+
+    /**
+     * @brief Returns a view of the stored moves; empty if moves are recomputed from the seed.
+     */
+    MoveSequenceView sequence() const { return m_storage.view(); }
+
+    /**
+     * @brief Returns the storage policy.
+     */
+    Storage &storage() { return m_storage; }
+    const Storage &storage() const { return m_storage; }
+
+    /**
+     * @brief Clears the game and sets the seed of the next one, without starting it.
+     */
+    void reset(quint64 seed) {
+        m_seed = seed;
+        m_round = 0;
+        m_userIndex = 0;
+        m_storage.clear();
+    }
+
+    /**
+     * @brief Starts a new game: clears the state and begins the first round.
+     */
+    void start(quint64 seed) {
+        reset(seed);
+        advanceRound();
+    }
+
+    /**
+     * @brief Changes the seed of the game in progress, keeping its round.
+     */
+    void reseed(quint64 seed) {
+        m_seed = seed;
+        repack();
+    }
+
+    /**
+     * @brief Rebuilds the stored moves from the seed, e.g. after a storage change.
+     */
+    void repack() {
+        m_storage.clear();
+        if (m_storage.isSeeded())
+            return;
+        for (int i = 0; i < m_round; i++)
+            m_storage.append(CounterRng::moveAt(m_seed, static_cast<quint64>(i), colorCount()));
+    }
+
+    /**
+     * @brief Moves to the next round, resets the player's progress and draws the new move.
+     */
+    void advanceRound() {
+        m_storage.append(CounterRng::moveAt(m_seed, static_cast<quint64>(m_round), colorCount()));
+        m_round++;
+        m_userIndex = 0;
+    }
+
+    /**
+     * @brief Checks a single press.
+     *
+     * A correct press advances the player's progress and, at the end of the
+     * sequence, starts the next round. A wrong press changes nothing.
+     *
+     * @param color The color index pressed.
+     * @return What the press did.
+     */
+    PressOutcome press(int color) {
+        if (m_userIndex >= m_round || moveAt(m_userIndex) != color)
+            return PressOutcome::Wrong;
+        if (++m_userIndex < m_round)
+            return PressOutcome::Progress;
+        advanceRound();
+        return PressOutcome::RoundComplete;
+    }
+
+    /**
+     * @brief Checks a burst of presses, comparing them with the sequence a word at a time.
+     *
+     * Presses that complete a round carry on into the next one exactly as
+     * press() would; presses after the first wrong one are ignored.
+     *
+     * @param presses The presses as color indices, packed with bitsPerMove() bits each.
+     * @return How many presses matched, the first mismatch and the rounds completed.
+     */
+    PressBatchResult pressBatch(MoveSequenceView presses) {
+        Q_ASSERT(presses.bitsPerMove() == bitsPerMove());
+        PressBatchResult result;
+        const int bits = presses.bitsPerMove();
+        const int movesPerWord = presses.movesPerWord();
+        qsizetype consumed = 0;
+
+        while (consumed < presses.size()) {
+            // Compare as many presses as remain in this round, one word at a time.
+            int count = static_cast<int>(qMin<qsizetype>(movesPerWord, qMin<qsizetype>(presses.size() - consumed,
+                                                                                      m_round - m_userIndex)));
+            if (count <= 0) {
+                // No game in progress: any press is wrong.
+                result.mismatchIndex = consumed;
+                break;
+            }
+            quint64 diff = presses.packedAt(consumed, count) ^ packedAt(m_userIndex, count);
+            if (diff != 0) {
+                // The lowest differing bit belongs to the first wrong press.
+                int matched = static_cast<int>(qCountTrailingZeroBits(diff)) / bits;
+                m_userIndex += matched;
+                consumed += matched;
+                result.mismatchIndex = consumed;
+                break;
+            }
+            m_userIndex += count;
+            consumed += count;
+
+            // A completed round carries on into the next one.
+            if (m_userIndex == m_round) {
+                advanceRound();
+                result.roundsCompleted++;
+            }
+        }
+
+        result.accepted = consumed;
+        result.round = m_round;
+        result.progress = m_userIndex;
+        return result;
+    }
+
+    /**
+     * @brief Returns the current round and its tempo for playback.
+     */
+    PlaybackRound playbackRound() const {
+        return m_storage.playback(m_seed, colorCount(), m_round, m_round, stepMsForRound(m_round));
+    }
+
+private:
+    Storage m_storage;              ///< How the moves are kept.
+    quint64 m_seed;                 ///< Seed of the current game's moves.
+    int m_round = 0;                ///< The current round, also the number of moves.
+    int m_userIndex = 0;            ///< The index of the next move the player needs to match.
+    int m_colors = HasDynamicColors ? MinColors : Colors; ///< Number of colors with DynamicColors.
+};
+
+#endif // SIMONCORE_H
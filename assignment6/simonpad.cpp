@@ -0,0 +1,64 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * simonpad.cpp
+ *
+ * This file implements the SimonPad widget. Colors for every visual state
+ * are derived once in setColor(); paintEvent() only looks them up.
+ */
+
+#include "simonpad.h"
+#include "tracer.h"
+#include <QPainter>
+
+SimonPad::SimonPad(QWidget *parent)
+    : QPushButton(parent),
+    m_flashed(false)
+{
+    setColor(Qt::gray);
+}
+
+void SimonPad::setColor(const QColor &color, const QColor &flashColor) {
+    m_fill[Normal] = color;
+    m_fill[Flashed] = flashColor;
+    m_fill[Pressed] = color.darker(130);
+    for (int state = 0; state < StateCount; state++)
+        m_border[state] = m_fill[state].darker(150);
+    update();
+}
+
+void SimonPad::setFlashed(bool flashed) {
+    if (m_flashed == flashed)
+        return;
+    m_flashed = flashed;
+    // Only this pad needs repainting; nothing is re-polished.
+    update();
+}
+
+SimonPad::VisualState SimonPad::visualState() const {
+    if (m_flashed)
+        return Flashed;
+    if (isDown())
+        return Pressed;
+    return Normal;
+}
+
+void SimonPad::paintEvent(QPaintEvent *) {
+    Tracer::Scope trace("SimonPad::paintEvent", "paint");
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    // Fill a rounded body with the colors of the current state.
+    VisualState state = visualState();
+    QRectF body = QRectF(rect()).adjusted(1, 1, -1, -1);
+    painter.setPen(QPen(m_border[state], 2));
+    painter.setBrush(m_fill[state]);
+    painter.drawRoundedRect(body, 5, 5);
+
+    // Draw the label on top.
+    painter.setPen(palette().color(QPalette::ButtonText));
+    painter.drawText(rect(), Qt::AlignCenter, text());
+}
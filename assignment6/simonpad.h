@@ -0,0 +1,86 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * simonpad.h
+ *
+ * This file declares the SimonPad widget, the colored button the player
+ * presses in the Simon game. A SimonPad paints itself from colors that are
+ * computed once for its normal, flashed and pressed states, so flashing a
+ * pad is a state flip plus a repaint of the pad alone instead of a style
+ * sheet change that has to be parsed and re-polished.
+ *
+ * Usage:
+ *  - Promote a QPushButton to SimonPad in Qt Designer (header simonpad.h).
+ *  - Call setColor() once and setFlashed() to show or hide the flash.
+ */
+
+#ifndef SIMONPAD_H
+#define SIMONPAD_H
+
+#include <QColor>
+#include <QPushButton>
+
+class SimonPad : public QPushButton {
+    Q_OBJECT
+public:
+    /**
+     * @brief Visual states a pad can be painted in.
+     */
+    enum VisualState {
+        Normal,  ///< The pad's own color.
+        Flashed, ///< Lit during playback.
+        Pressed, ///< Held down by the player.
+        StateCount
+    };
+
+    /**
+     * @brief Constructs a gray pad.
+     * @param parent Optional parent widget.
+     */
+    explicit SimonPad(QWidget *parent = nullptr);
+
+    /**
+     * @brief Sets the pad's colors and precomputes the colors of every state.
+     * @param color The color shown in the normal state.
+     * @param flashColor The color shown while the pad is lit.
+     */
+    void setColor(const QColor &color, const QColor &flashColor = QColor(Qt::yellow));
+
+    /**
+     * @brief Returns the pad's color in the normal state.
+     */
+    QColor color() const { return m_fill[Normal]; }
+
+    /**
+     * @brief Shows or hides the flash. Only repaints the pad if the state changes.
+     * @param flashed True to light the pad.
+     */
+    void setFlashed(bool flashed);
+
+    /**
+     * @brief Returns true while the pad is lit.
+     */
+    bool isFlashed() const { return m_flashed; }
+
+    /**
+     * @brief Returns the state the pad is currently painted in.
+     */
+    VisualState visualState() const;
+
+protected:
+    /**
+     * @brief Paints the pad from its precomputed state colors.
+     * @param event Pointer to the QPaintEvent.
+     */
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    QColor m_fill[StateCount];   ///< Fill color of each state.
+    QColor m_border[StateCount]; ///< Border color of each state.
+    bool m_flashed;              ///< True while the pad is lit.
+};
+
+#endif // SIMONPAD_H
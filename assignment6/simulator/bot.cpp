@@ -0,0 +1,71 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * bot.cpp
+ *
+ * This file implements the Bot used by the headless simulator.
+ */
+
+#include "bot.h"
+#include <cmath>
+
+namespace {
+
+// The standard distributions require a strictly positive deviation.
+constexpr double MinStdDev = 1e-9;
+
+// Converts the mean and deviation of the delay into the parameters of the
+// underlying normal distribution of a log-normal one.
+std::lognormal_distribution<double> makeLogNormal(double mean, double stdDev) {
+    if (mean <= 0.0)
+        return std::lognormal_distribution<double>(0.0, 1.0); // Unused; see reactionDelayMs().
+    double variance = stdDev * stdDev;
+    double sigma2 = std::log(1.0 + variance / (mean * mean));
+    return std::lognormal_distribution<double>(std::log(mean) - sigma2 / 2.0,
+                                               qMax(MinStdDev, std::sqrt(sigma2)));
+}
+
+}
+
+Bot::Bot(const BotProfile &profile, quint64 seed)
+    : m_profile(profile),
+    m_rng(seed),
+    m_error(qBound(0.0, profile.errorRate, 1.0)),
+    m_normal(profile.reactionMeanMs, qMax(MinStdDev, profile.reactionStdDevMs)),
+    m_logNormal(makeLogNormal(profile.reactionMeanMs, qMax(MinStdDev, profile.reactionStdDevMs)))
+{
+}
+
+void Bot::reseed(quint64 seed) {
+    m_rng.seed(seed);
+    // Drop values the distributions cached from the old sequence.
+    m_error.reset();
+    m_normal.reset();
+    m_logNormal.reset();
+}
+
+int Bot::respond(int expected, int colors) {
+    // A perfect bot never needs to touch its generator.
+    if (isPerfect() || !m_error(m_rng))
+        return expected;
+    // Pick one of the other colors uniformly.
+    std::uniform_int_distribution<int> other(1, colors - 1);
+    return (expected + other(m_rng)) % colors;
+}
+
+double Bot::reactionDelayMs() {
+    switch (m_profile.reaction) {
+    case ReactionModel::None:
+        return 0.0;
+    case ReactionModel::Constant:
+        return m_profile.reactionMeanMs;
+    case ReactionModel::Normal:
+        return qMax(0.0, m_normal(m_rng));
+    case ReactionModel::LogNormal:
+        return m_profile.reactionMeanMs > 0.0 ? m_logNormal(m_rng) : 0.0;
+    }
+    return 0.0;
+}
@@ -0,0 +1,91 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * bot.h
+ *
+ * This file declares the Bot used by the headless simulator to play Simon.
+ * A Bot answers each move of the sequence, optionally pressing the wrong
+ * button with a fixed error rate, and samples a reaction delay for every
+ * press from a configurable distribution. Delays are simulated, not slept,
+ * so they are accounted as play time without slowing the simulation down.
+ *
+ * Usage:
+ *  - Fill a BotProfile and construct one Bot per worker thread.
+ *  - Call respond() with the expected move to get the pad to press.
+ */
+
+#ifndef BOT_H
+#define BOT_H
+
+#include <QtGlobal>
+#include <random>
+
+/**
+ * @brief Distribution of the simulated delay between a flash and a press.
+ */
+enum class ReactionModel {
+    None,      ///< Presses are instantaneous.
+    Constant,  ///< Every press takes exactly the mean delay.
+    Normal,    ///< Normally distributed around the mean, clamped at zero.
+    LogNormal  ///< Log-normally distributed with the given mean and deviation.
+};
+
+/**
+ * @brief How a bot plays.
+ */
+struct BotProfile {
+    double errorRate = 0.0;                     ///< Probability of pressing the wrong button.
+    ReactionModel reaction = ReactionModel::None; ///< Distribution of the reaction delay.
+    double reactionMeanMs = 250.0;              ///< Mean reaction delay, in milliseconds.
+    double reactionStdDevMs = 50.0;             ///< Standard deviation of the delay, in milliseconds.
+};
+
+class Bot {
+public:
+    /**
+     * @brief Constructs a bot.
+     * @param profile How the bot plays.
+     * @param seed Seed of the bot's own random generator.
+     */
+    Bot(const BotProfile &profile, quint64 seed);
+
+    /**
+     * @brief Decides which pad to press for the expected move.
+     *
+     * A mistake presses one of the other colors, chosen uniformly.
+     *
+     * @param expected The correct color index.
+     * @param colors Number of colors in the game.
+     * @return The color index the bot presses.
+     */
+    int respond(int expected, int colors);
+
+    /**
+     * @brief Samples the reaction delay of the next press.
+     * @return The delay in milliseconds, never negative.
+     */
+    double reactionDelayMs();
+
+    /**
+     * @brief Restarts the bot's random generator, e.g. for a new game.
+     * @param seed Seed of the bot's own random generator.
+     */
+    void reseed(quint64 seed);
+
+    /**
+     * @brief Returns true if the bot never makes mistakes.
+     */
+    bool isPerfect() const { return m_profile.errorRate <= 0.0; }
+
+private:
+    BotProfile m_profile;                      ///< How the bot plays.
+    std::mt19937_64 m_rng;                     ///< The bot's private random generator.
+    std::bernoulli_distribution m_error;       ///< Draws whether a press is wrong.
+    std::normal_distribution<double> m_normal; ///< Delay distribution for ReactionModel::Normal.
+    std::lognormal_distribution<double> m_logNormal; ///< Delay distribution for ReactionModel::LogNormal.
+};
+
+#endif // BOT_H
@@ -0,0 +1,156 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * main.cpp (simulator)
+ *
+ * The entry point of the headless Simon simulator. It parses the command
+ * line, plays the requested number of games with bots on all worker threads
+ * and prints throughput numbers together with the distribution of the round
+ * each game ended in.
+ *
+ * Example:
+ *   simonsim --games 1000000 --threads 16 --error-rate 0.02 --reaction lognormal
+ */
+
+#include "simulation.h"
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QTextStream>
+#include <QThread>
+
+namespace {
+
+// Returns the smallest round r such that at least the given fraction of games ended at or before r.
+int percentileRound(const QVector<qint64> &finalRounds, qint64 games, double fraction) {
+    qint64 target = static_cast<qint64>(fraction * games);
+    qint64 seen = 0;
+    for (int r = 0; r < finalRounds.size(); r++) {
+        seen += finalRounds[r];
+        if (seen > target || seen == games)
+            return r;
+    }
+    return finalRounds.size() - 1;
+}
+
+// Returns a final round for the report; rounds past the maximum mean the game was capped.
+QString roundLabel(int round, int maxRounds) {
+    return round > maxRounds ? QStringLiteral("capped") : QString::number(round);
+}
+
+void printReport(QTextStream &out, const SimulationConfig &config,
+                 const SimulationStats &stats, qint64 elapsedNs) {
+    double seconds = qMax(elapsedNs, qint64(1)) / 1e9;
+    out << "Simon simulation: " << stats.games << " games with " << config.colors
+        << " colors on " << config.threads
+        << " threads (seed " << config.seed << ")\n";
+    out << QString("  wall time     : %1 s\n").arg(seconds, 0, 'f', 3);
+    out << QString("  games/sec     : %1\n").arg(stats.games / seconds, 0, 'f', 0);
+    out << QString("  rounds/sec    : %1\n").arg(stats.rounds / seconds, 0, 'f', 0);
+    out << QString("  presses/sec   : %1\n").arg(stats.presses / seconds, 0, 'f', 0);
+    out << QString("  capped games  : %1 (reached %2 rounds)\n").arg(stats.cappedGames).arg(config.maxRounds);
+    if (stats.presses > 0) {
+        out << QString("  mean reaction : %1 ms, %2 h of simulated play\n")
+                   .arg(stats.simulatedMs / stats.presses, 0, 'f', 1)
+                   .arg(stats.simulatedMs / 3.6e6, 0, 'f', 2);
+    }
+    if (stats.games == 0)
+        return;
+
+    // Summary of the round each game ended in; capped games sort after every loss.
+    double sum = 0;
+    int maxRound = 0;
+    for (int r = 0; r <= config.maxRounds; r++) {
+        sum += double(r) * stats.finalRounds[r];
+        if (stats.finalRounds[r] > 0)
+            maxRound = r;
+    }
+    const qint64 lostGames = stats.games - stats.cappedGames;
+    out << "Final round distribution:\n";
+    out << QString("  mean of lost games %1, p50 %2, p90 %3, p99 %4, max lost %5\n")
+               .arg(lostGames > 0 ? sum / lostGames : 0.0, 0, 'f', 2)
+               .arg(roundLabel(percentileRound(stats.finalRounds, stats.games, 0.50), config.maxRounds))
+               .arg(roundLabel(percentileRound(stats.finalRounds, stats.games, 0.90), config.maxRounds))
+               .arg(roundLabel(percentileRound(stats.finalRounds, stats.games, 0.99), config.maxRounds))
+               .arg(maxRound);
+
+    // Power-of-two buckets keep the table short for any maximum round count.
+    for (int low = 1; low <= maxRound; low *= 2) {
+        int high = qMin(low * 2 - 1, maxRound);
+        qint64 count = 0;
+        for (int r = low; r <= high; r++)
+            count += stats.finalRounds[r];
+        double share = 100.0 * count / stats.games;
+        out << QString("  [%1, %2]").arg(low, 7).arg(high, 7)
+            << QString(" %1 %2% ").arg(count, 12).arg(share, 6, 'f', 2)
+            << QString(static_cast<int>(share / 2), QLatin1Char('#')) << "\n";
+    }
+    if (stats.cappedGames > 0) {
+        double share = 100.0 * stats.cappedGames / stats.games;
+        out << QString("  %1").arg("capped", 18)
+            << QString(" %1 %2% ").arg(stats.cappedGames, 12).arg(share, 6, 'f', 2)
+            << QString(static_cast<int>(share / 2), QLatin1Char('#')) << "\n";
+    }
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("simonsim");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Plays Simon games headlessly with bots on all cores.");
+    parser.addHelpOption();
+    QCommandLineOption gamesOption("games", "Total number of games to play.", "count", "100000");
+    QCommandLineOption threadsOption("threads", "Number of worker threads.", "count",
+                                     QString::number(QThread::idealThreadCount()));
+    QCommandLineOption maxRoundsOption("max-rounds", "Stop a game after this many rounds.", "rounds", "100");
+    QCommandLineOption seedOption("seed", "Seed of the run.", "seed", "1");
+    QCommandLineOption colorsOption("colors", "Number of colors, from 2 to 16.", "count", "2");
+    QCommandLineOption seededOption("seeded", "Keep only the seed of each game instead of the packed sequence.");
+    QCommandLineOption errorOption("error-rate", "Probability that a bot presses the wrong button.", "p", "0");
+    QCommandLineOption reactionOption("reaction", "Reaction delay distribution: none, constant, normal or lognormal.",
+                                      "model", "none");
+    QCommandLineOption meanOption("reaction-mean", "Mean reaction delay in milliseconds.", "ms", "250");
+    QCommandLineOption stdDevOption("reaction-stddev", "Standard deviation of the reaction delay in milliseconds.",
+                                    "ms", "50");
+    parser.addOptions({gamesOption, threadsOption, maxRoundsOption, seedOption, colorsOption, seededOption,
+                       errorOption, reactionOption, meanOption, stdDevOption});
+    parser.process(app);
+
+    SimulationConfig config;
+    config.games = parser.value(gamesOption).toLongLong();
+    config.threads = parser.value(threadsOption).toInt();
+    config.maxRounds = parser.value(maxRoundsOption).toInt();
+    config.seed = parser.value(seedOption).toULongLong();
+    config.colors = qBound(MinColors, parser.value(colorsOption).toInt(), MaxColors);
+    config.mode = parser.isSet(seededOption) ? SequenceMode::Seeded : SequenceMode::Stored;
+    config.bot.errorRate = parser.value(errorOption).toDouble();
+    config.bot.reactionMeanMs = parser.value(meanOption).toDouble();
+    config.bot.reactionStdDevMs = parser.value(stdDevOption).toDouble();
+
+    const QString reaction = parser.value(reactionOption).toLower();
+    if (reaction == "none") {
+        config.bot.reaction = ReactionModel::None;
+    } else if (reaction == "constant") {
+        config.bot.reaction = ReactionModel::Constant;
+    } else if (reaction == "normal") {
+        config.bot.reaction = ReactionModel::Normal;
+    } else if (reaction == "lognormal") {
+        config.bot.reaction = ReactionModel::LogNormal;
+    } else {
+        QTextStream(stderr) << "Unknown reaction model: " << reaction << "\n";
+        return 1;
+    }
+
+    Simulation simulation(config);
+    SimulationStats stats = simulation.run();
+
+    QTextStream out(stdout);
+    printReport(out, config, stats, simulation.elapsedNs());
+    return 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * simulation.cpp
+ *
+ * This file implements the Simulation class used by the headless simulator.
+ * Workers never share a SimonCore or a Bot, so they run without any locking and
+ * throughput scales with the number of cores.
+ */
+
+#include "simulation.h"
+#include "counterrng.h"
+#include <QElapsedTimer>
+#include <QThread>
+#include <memory>
+#include <vector>
+
+void SimulationStats::merge(const SimulationStats &other) {
+    games += other.games;
+    cappedGames += other.cappedGames;
+    rounds += other.rounds;
+    presses += other.presses;
+    simulatedMs += other.simulatedMs;
+    if (finalRounds.size() < other.finalRounds.size())
+        finalRounds.resize(other.finalRounds.size());
+    for (int r = 0; r < other.finalRounds.size(); r++)
+        finalRounds[r] += other.finalRounds[r];
+}
+
+Simulation::Simulation(const SimulationConfig &config)
+    : m_config(config),
+    m_elapsedNs(0)
+{
+    m_config.threads = qMax(1, m_config.threads);
+    m_config.maxRounds = qMax(1, m_config.maxRounds);
+}
+
+SimulationStats Simulation::run() {
+    QElapsedTimer timer;
+    timer.start();
+
+    // Split the games as evenly as possible; the first workers take the remainder.
+    const int threads = m_config.threads;
+    std::vector<SimulationStats> results(threads);
+    std::vector<std::unique_ptr<QThread>> workers;
+    qint64 firstGame = 0;
+    for (int w = 0; w < threads; w++) {
+        qint64 games = m_config.games / threads + (w < m_config.games % threads ? 1 : 0);
+        workers.emplace_back(QThread::create([this, &results, w, firstGame, games]() {
+            results[w] = runWorker(firstGame, games);
+        }));
+        workers.back()->start();
+        firstGame += games;
+    }
+    for (auto &worker : workers)
+        worker->wait();
+
+    SimulationStats total;
+    for (const SimulationStats &result : results)
+        total.merge(result);
+    m_elapsedNs = timer.nsecsElapsed();
+    return total;
+}
+
+SimulationStats Simulation::runWorker(qint64 firstGame, qint64 games) const {
+    // Pick the storage once so the rules are inlined without a per-move branch.
+    if (m_config.mode == SequenceMode::Seeded)
+        return playGames<SeededStorage>(firstGame, games);
+    return playGames<PackedStorage>(firstGame, games);
+}
+
+template <typename Storage>
+SimulationStats Simulation::playGames(qint64 firstGame, qint64 games) const {
+    SimulationStats stats;
+    // One entry per round a game can be lost in, and one past them for capped games.
+    stats.finalRounds.resize(m_config.maxRounds + 2);
+
+    SimonCore<DynamicColors, Storage> core;
+    core.setColorCount(m_config.colors);
+    Bot bot(m_config.bot, 0);
+
+    for (qint64 g = 0; g < games; g++) {
+        // The game and the bot playing it are seeded from the game's index,
+        // so runs are reproducible for any thread count.
+        const quint64 game = static_cast<quint64>(firstGame + g);
+        core.start(CounterRng::valueAt(m_config.seed, game));
+        bot.reseed(CounterRng::valueAt(~m_config.seed, game));
+
+        // The last correct press of a round starts the next one.
+        bool lost = false;
+        while (!lost) {
+            int length = core.round();
+            if (length > m_config.maxRounds) {
+                stats.cappedGames++;
+                break;
+            }
+            for (int i = 0; i < length && !lost; i++) {
+                stats.simulatedMs += bot.reactionDelayMs();
+                int press = bot.respond(core.moveAt(i), core.colorCount());
+                stats.presses++;
+                lost = core.press(press) == PressOutcome::Wrong;
+            }
+            if (!lost)
+                stats.rounds++;
+        }
+
+        stats.games++;
+        // A capped game stopped in round maxRounds + 1, which lands it in the capped entry.
+        stats.finalRounds[core.round()]++;
+    }
+    return stats;
+}
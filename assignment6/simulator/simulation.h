@@ -0,0 +1,97 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * simulation.h
+ *
+ * This file declares the Simulation class used by the headless simulator.
+ * A Simulation splits a number of games across worker threads. Every worker
+ * owns an independent SimonCore and a Bot, plays its share of the games by
+ * calling SimonCore::press directly (no QObject or signal is involved), and
+ * collects statistics that are merged once all workers are done.
+ *
+ * Each game's moves and the bot's choices in it are seeded from the
+ * simulation seed and the game's index, so a run is reproducible regardless
+ * of the number of threads.
+ */
+
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <QVector>
+#include "bot.h"
+#include "simoncore.h"
+
+/**
+ * @brief Parameters of a simulation run.
+ */
+struct SimulationConfig {
+    int threads = 1;         ///< Number of worker threads, each with its own SimonCore.
+    qint64 games = 10000;    ///< Total number of games to play.
+    int maxRounds = 100;     ///< Games that complete this many rounds are stopped.
+    quint64 seed = 0;        ///< Seed of the whole run.
+    int colors = MinColors;  ///< Number of colors of every game.
+    SequenceMode mode = SequenceMode::Stored; ///< How every game keeps its moves.
+    BotProfile bot;          ///< How the bots play.
+};
+
+/**
+ * @brief Counters collected by the workers.
+ */
+struct SimulationStats {
+    qint64 games = 0;       ///< Games played.
+    qint64 cappedGames = 0; ///< Games stopped at maxRounds without a loss.
+    qint64 rounds = 0;      ///< Rounds completed.
+    qint64 presses = 0;     ///< Presses validated by the core.
+    double simulatedMs = 0; ///< Sum of all simulated reaction delays.
+    QVector<qint64> finalRounds; ///< finalRounds[r] is the number of games lost in round r; the last entry counts the capped games.
+
+    /**
+     * @brief Adds the counters of another worker to this one.
+     * @param other The counters to add.
+     */
+    void merge(const SimulationStats &other);
+};
+
+class Simulation {
+public:
+    /**
+     * @brief Constructs a simulation.
+     * @param config Parameters of the run.
+     */
+    explicit Simulation(const SimulationConfig &config);
+
+    /**
+     * @brief Plays every game and blocks until all workers are done.
+     * @return The merged counters of all workers.
+     */
+    SimulationStats run();
+
+    /**
+     * @brief Returns the wall-clock duration of the last run, in nanoseconds.
+     */
+    qint64 elapsedNs() const { return m_elapsedNs; }
+
+private:
+    /**
+     * @brief Plays a contiguous range of games on the calling thread.
+     * @param firstGame Index of the first game of the range.
+     * @param games Number of games in the range.
+     * @return The counters of the range.
+     */
+    SimulationStats runWorker(qint64 firstGame, qint64 games) const;
+
+    /**
+     * @brief Plays a range of games with the rules inlined for one storage policy.
+     * @tparam Storage PackedStorage or SeededStorage.
+     */
+    template <typename Storage>
+    SimulationStats playGames(qint64 firstGame, qint64 games) const;
+
+    SimulationConfig m_config; ///< Parameters of the run.
+    qint64 m_elapsedNs;        ///< Duration of the last run.
+};
+
+#endif // SIMULATION_H
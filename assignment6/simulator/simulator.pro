@@ -0,0 +1,25 @@
+# Headless bot-driven simulation of the Simon game logic.
+# Built against QtCore only; no QApplication or widgets are involved.
+
+QT = core
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = simonsim
+
+include(../gamecore.pri)
+
+SOURCES += \
+    bot.cpp \
+    main.cpp \
+    simulation.cpp
+
+HEADERS += \
+    bot.h \
+    simulation.h
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
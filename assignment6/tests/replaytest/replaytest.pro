@@ -0,0 +1,20 @@
+# QtTest checks for the replay journal: writing, reading back and verifying.
+# Run with e.g. "tst_replaytest".
+
+QT = core testlib
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+TARGET = tst_replaytest
+
+include(../../gamecore.pri)
+
+INCLUDEPATH += ../../replayverifier
+
+SOURCES += \
+    tst_replaytest.cpp \
+    ../../replayverifier/verifier.cpp
+
+HEADERS += \
+    ../../replayverifier/verifier.h
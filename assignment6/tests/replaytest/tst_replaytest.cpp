@@ -0,0 +1,112 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * tst_replaytest.cpp
+ *
+ * QtTest checks for the replay journal. tornTail cuts a journal in the
+ * middle of a record, as a run killed during a flush would leave it,
+ * appends another session and checks that the ReplayReader and the
+ * Verifier still see every complete game.
+ */
+
+#include <QtTest>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+#include "replayreader.h"
+#include "replaywriter.h"
+#include "simoncore.h"
+#include "verifier.h"
+
+namespace {
+
+// Journals a game the way the Model does: it reaches the given round and ends on a wrong press.
+void playGame(ReplayWriter &journal, quint64 seed, int rounds) {
+    SimonCore<DynamicColors, SeededStorage> core;
+    core.setColorCount(4);
+    core.start(seed);
+    journal.gameStarted(core.colorCount(), seed);
+    journal.roundStarted(core.round());
+    while (core.round() < rounds) {
+        const int length = core.round();
+        for (int i = 0; i < length; i++) {
+            const int move = core.moveAt(i);
+            journal.pressed(move);
+            core.press(move);
+        }
+        journal.roundStarted(core.round());
+    }
+    const int wrong = (core.moveAt(0) + 1) % core.colorCount();
+    journal.pressed(wrong);
+    core.press(wrong);
+    journal.lost();
+}
+
+// Returns the number of games the reader finds, or -1 if it stops at a damaged record.
+int countGames(const QString &path) {
+    ReplayReader reader;
+    if (!reader.open(path))
+        return -1;
+    int games = 0;
+    ReplayReader::Record record;
+    while (reader.next(record)) {
+        if (record.type == ReplayReader::RecordType::GameStart)
+            games++;
+    }
+    return reader.hasError() ? -1 : games;
+}
+
+}
+
+class ReplayTest : public QObject {
+    Q_OBJECT
+
+private slots:
+    void tornTail();
+};
+
+void ReplayTest::tornTail() {
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString path = dir.filePath("games.simonrj");
+
+    // The first session: three complete games, then a game whose start is cut off.
+    qint64 complete = 0;
+    {
+        ReplayWriter journal;
+        QVERIFY(journal.open(path));
+        for (int game = 0; game < 3; game++)
+            playGame(journal, 1000 + game, 4 + game);
+        QVERIFY(journal.flush());
+        complete = QFileInfo(path).size();
+        journal.gameStarted(4, 2000);
+    }
+    QFile file(path);
+    QVERIFY(file.resize(complete + 5));
+    QCOMPARE(countGames(path), -1);
+
+    // The second session appends after the last complete record.
+    {
+        ReplayWriter journal;
+        QVERIFY(journal.open(path));
+        QCOMPARE(QFileInfo(path).size(), complete);
+        playGame(journal, 3000, 5);
+        playGame(journal, 3001, 2);
+    }
+    QCOMPARE(countGames(path), 5);
+
+    Verifier verifier(2);
+    VerifyStats stats;
+    QVERIFY(verifier.verify(path, stats));
+    QVERIFY(!verifier.damaged());
+    QCOMPARE(stats.games, qint64(5));
+    QCOMPARE(stats.mismatchedGames, qint64(0));
+    QCOMPARE(stats.lostGames, qint64(5));
+}
+
+QTEST_GUILESS_MAIN(ReplayTest)
+
+#include "tst_replaytest.moc"
@@ -0,0 +1,112 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * tracer.cpp
+ *
+ * This file implements the Tracer. A thread finds its ring through a
+ * thread_local pointer; the mutex is only taken to register a new ring and
+ * to export, never on the recording path.
+ */
+
+#include "tracer.h"
+#include <QCoreApplication>
+#include <QEvent>
+#include <QFile>
+#include <QMutexLocker>
+
+std::atomic<bool> Tracer::s_enabled(false);
+thread_local Tracer::Ring *Tracer::t_ring = nullptr;
+
+Tracer::Tracer() {
+    m_clock.start();
+}
+
+Tracer::~Tracer() {
+    qDeleteAll(m_rings);
+}
+
+Tracer &Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+Tracer::Ring *Tracer::ring() {
+    if (t_ring)
+        return t_ring;
+    // First event of this thread: allocate its ring once and register it for the export.
+    Ring *ring = new Ring;
+    ring->storage.resize(RingCapacity);
+    ring->events = ring->storage.data();
+    ring->head.store(0, std::memory_order_relaxed);
+    QMutexLocker locker(&m_mutex);
+    ring->tid = m_rings.size() + 1;
+    m_rings.append(ring);
+    t_ring = ring;
+    return ring;
+}
+
+void Tracer::record(const char *name, const char *category, char phase) {
+    Ring *r = ring();
+    // Only this thread writes the ring; the release store publishes the slot to the exporter.
+    const quint64 head = r->head.load(std::memory_order_relaxed);
+    Event &event = r->events[head & (RingCapacity - 1)];
+    event.name = name;
+    event.category = category;
+    event.ns = m_clock.nsecsElapsed();
+    event.phase = phase;
+    r->head.store(head + 1, std::memory_order_release);
+}
+
+QByteArray Tracer::toChromeJson() const {
+    const qint64 pid = QCoreApplication::applicationPid();
+    QByteArray json;
+    json.reserve(1 << 20);
+    json += "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+
+    QMutexLocker locker(&m_mutex);
+    QVector<Event> copy;
+    for (const Ring *r : m_rings) {
+        // Copy the live part of the ring, then drop what the writer overwrote meanwhile.
+        const quint64 end = r->head.load(std::memory_order_acquire);
+        const quint64 begin = end > quint64(RingCapacity) ? end - RingCapacity : 0;
+        copy.clear();
+        for (quint64 i = begin; i < end; i++)
+            copy.append(r->events[i & (RingCapacity - 1)]);
+        const quint64 after = r->head.load(std::memory_order_acquire);
+        const quint64 valid = after > quint64(RingCapacity) ? after - RingCapacity : 0;
+        const qsizetype skip = valid > begin ? qsizetype(qMin(valid - begin, end - begin)) : 0;
+
+        json += QByteArray(first ? "" : ",")
+                + QByteArray::asprintf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%lld,\"tid\":%d,"
+                                       "\"args\":{\"name\":\"thread %d\"}}", pid, r->tid, r->tid);
+        first = false;
+        for (qsizetype i = skip; i < copy.size(); i++) {
+            const Event &e = copy[i];
+            // Chrome wants microseconds; keep the nanoseconds as decimals.
+            json += QByteArray::asprintf(",{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,"
+                                         "\"pid\":%lld,\"tid\":%d%s}",
+                                         e.name, e.category, e.phase, e.ns / 1000.0, pid, r->tid,
+                                         e.phase == 'i' ? ",\"s\":\"t\"" : "");
+        }
+    }
+    json += "]}\n";
+    return json;
+}
+
+bool Tracer::writeChromeJson(const QString &path) const {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        return false;
+    const QByteArray json = toChromeJson();
+    return file.write(json) == json.size();
+}
+
+bool TracePaintFilter::eventFilter(QObject *watched, QEvent *event) {
+    if (event->type() == QEvent::Paint)
+        Tracer::instant(watched->metaObject()->className(), "paint");
+    return QObject::eventFilter(watched, event);
+}
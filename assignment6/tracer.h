@@ -0,0 +1,180 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * tracer.h
+ *
+ * This file declares the Tracer used to see what the Simon game's event
+ * loop spends its time on. Model slots and signals, frames, flashes, pad
+ * animations and paints are recorded as begin/end pairs or instants and
+ * exported as Chrome trace JSON, which chrome://tracing and Perfetto open
+ * directly.
+ *
+ * Recording is off by default and then costs one relaxed atomic load per
+ * trace point. When it is on, each thread writes into its own ring buffer
+ * of RingCapacity events: a store into the next slot and a release store
+ * of the ring's head, with no locks and no allocation after the thread's
+ * first event. When a ring is full the oldest events are overwritten, so a
+ * trace always holds the most recent work before the export.
+ *
+ * Event names and categories are not copied; they must be string literals
+ * or other strings that live as long as the program, such as class names
+ * from a QMetaObject.
+ *
+ * Usage:
+ *  - Call Tracer::setEnabled(true) to start recording.
+ *  - Put a Tracer::Scope at the top of a function to trace its duration, or
+ *    call Tracer::instant() for a point in time.
+ *  - Install a TracePaintFilter on the application to trace every paint.
+ *  - Call Tracer::instance().writeChromeJson() to save the trace.
+ */
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QVector>
+#include <atomic>
+
+class Tracer {
+public:
+    /// Events kept per thread before the oldest are overwritten.
+    static constexpr int RingCapacity = 1 << 16;
+
+    /**
+     * @brief One recorded event.
+     */
+    struct Event {
+        const char *name;     ///< What happened, e.g. "Model::press".
+        const char *category; ///< Group the event belongs to, e.g. "model".
+        qint64 ns;            ///< Time since the tracer was created.
+        char phase;           ///< 'B' for begin, 'E' for end, 'i' for an instant.
+    };
+
+    /**
+     * @brief Traces the lifetime of a scope as a begin/end pair.
+     *
+     * The scope decides once, when it is created, whether it records, so a
+     * trace never holds an end without its begin.
+     */
+    class Scope {
+    public:
+        Scope(const char *name, const char *category)
+            : m_name(name), m_category(category), m_enabled(isEnabled()) {
+            if (m_enabled)
+                instance().record(m_name, m_category, 'B');
+        }
+        ~Scope() {
+            if (m_enabled)
+                instance().record(m_name, m_category, 'E');
+        }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        const char *m_name;
+        const char *m_category;
+        bool m_enabled;
+    };
+
+    /**
+     * @brief Returns the process-wide tracer.
+     */
+    static Tracer &instance();
+
+    /**
+     * @brief Returns true while events are recorded.
+     */
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Starts or stops recording; recorded events are kept.
+     * @param enabled True to record events.
+     */
+    static void setEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief Records a point in time if recording is on.
+     * @param name What happened.
+     * @param category Group the event belongs to.
+     */
+    static void instant(const char *name, const char *category) {
+        if (isEnabled())
+            instance().record(name, category, 'i');
+    }
+
+    /**
+     * @brief Appends an event to the calling thread's ring.
+     * @param name What happened.
+     * @param category Group the event belongs to.
+     * @param phase 'B', 'E' or 'i'.
+     */
+    void record(const char *name, const char *category, char phase);
+
+    /**
+     * @brief Returns the events of every thread as Chrome trace JSON.
+     *
+     * Safe to call while other threads are recording; events they overwrite
+     * during the export are left out.
+     */
+    QByteArray toChromeJson() const;
+
+    /**
+     * @brief Writes toChromeJson() to a file.
+     * @param path The file to write.
+     * @return True if the whole trace was written.
+     */
+    bool writeChromeJson(const QString &path) const;
+
+private:
+    /**
+     * @brief The events of one thread, written only by that thread.
+     */
+    struct Ring {
+        int tid;                     ///< Thread number in the trace, from 1.
+        QVector<Event> storage;      ///< RingCapacity slots.
+        Event *events;               ///< storage.data(), cached for the writer.
+        std::atomic<quint64> head;   ///< Number of events ever written.
+    };
+
+    Tracer();
+    ~Tracer();
+    Tracer(const Tracer &) = delete;
+    Tracer &operator=(const Tracer &) = delete;
+
+    /**
+     * @brief Returns the calling thread's ring, creating it on first use.
+     */
+    Ring *ring();
+
+    static std::atomic<bool> s_enabled; ///< True while events are recorded.
+    static thread_local Ring *t_ring;   ///< The calling thread's ring, owned by the tracer.
+
+    QElapsedTimer m_clock;   ///< Time base of all events.
+    mutable QMutex m_mutex;  ///< Guards m_rings; taken once per thread and on export.
+    QVector<Ring*> m_rings;  ///< Every thread's ring, kept after the thread ends.
+};
+
+/**
+ * @brief Records an instant for every paint event, named after the widget's class.
+ *
+ * Install it on the application with QCoreApplication::installEventFilter();
+ * custom widgets that trace their paintEvent() with a Tracer::Scope add the
+ * duration of their own painting.
+ */
+class TracePaintFilter : public QObject {
+    Q_OBJECT
+public:
+    using QObject::QObject;
+
+protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+};
+
+#endif // TRACER_H
@@ -0,0 +1,120 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * virtualclock.cpp
+ *
+ * This file implements the VirtualClock and its timers.
+ */
+
+#include "virtualclock.h"
+#include <QPointer>
+#include <limits>
+
+/**
+ * @brief A timer whose deadline is kept in virtual time by its VirtualClock.
+ */
+class VirtualTimer : public GameTimer {
+public:
+    VirtualTimer(VirtualClock *clock, QObject *parent)
+        : GameTimer(parent),
+        m_clock(clock)
+    {
+        m_clock->m_timers.append(this);
+    }
+
+    ~VirtualTimer() override {
+        // The clock may already be gone if it did not outlive its timers.
+        if (m_clock)
+            m_clock->m_timers.removeOne(this);
+    }
+
+    void start(int ms) override {
+        m_interval = qMax(0, ms);
+        arm();
+    }
+
+    void setInterval(int ms) override {
+        m_interval = qMax(0, ms);
+        // Like QTimer, an active timer restarts with the new interval.
+        if (m_active)
+            arm();
+    }
+
+    void setSingleShot(bool singleShot) override { m_singleShot = singleShot; }
+    void stop() override { m_active = false; }
+    bool isActive() const override { return m_active; }
+
+    /**
+     * @brief Schedules the next timeout one interval from now.
+     */
+    void arm() {
+        if (!m_clock)
+            return;
+        m_deadline = m_clock->nowMs() + m_interval;
+        m_order = m_clock->m_nextOrder++;
+        m_active = true;
+    }
+
+    QPointer<VirtualClock> m_clock; ///< The clock keeping the time.
+    qint64 m_deadline = 0;          ///< Virtual time of the next timeout.
+    quint64 m_order = 0;            ///< Start order, to fire equal deadlines first come first served.
+    int m_interval = 0;             ///< Interval in milliseconds.
+    bool m_singleShot = false;      ///< True if the timer stops after one timeout.
+    bool m_active = false;          ///< True while a timeout is pending.
+};
+
+VirtualClock::VirtualClock(QObject *parent)
+    : Clock(parent),
+    m_now(0),
+    m_fired(0),
+    m_nextOrder(0)
+{
+}
+
+GameTimer *VirtualClock::createTimer(QObject *parent) {
+    return new VirtualTimer(this, parent);
+}
+
+void VirtualClock::advance(qint64 ms) {
+    const qint64 target = m_now + qMax<qint64>(0, ms);
+    // Timeouts may start other timers; keep picking the earliest until none is due.
+    while (VirtualTimer *timer = nextDue(target))
+        fire(timer);
+    m_now = target;
+}
+
+bool VirtualClock::advanceToNextTimer() {
+    VirtualTimer *timer = nextDue(std::numeric_limits<qint64>::max());
+    if (!timer)
+        return false;
+    fire(timer);
+    return true;
+}
+
+VirtualTimer *VirtualClock::nextDue(qint64 limit) const {
+    VirtualTimer *next = nullptr;
+    for (VirtualTimer *timer : m_timers) {
+        if (!timer->m_active || timer->m_deadline > limit)
+            continue;
+        if (!next || timer->m_deadline < next->m_deadline
+            || (timer->m_deadline == next->m_deadline && timer->m_order < next->m_order))
+            next = timer;
+    }
+    return next;
+}
+
+void VirtualClock::fire(VirtualTimer *timer) {
+    m_now = qMax(m_now, timer->m_deadline);
+    if (timer->m_singleShot) {
+        timer->m_active = false;
+    } else {
+        // Re-arm before the timeout so the receiver can still stop or restart it.
+        timer->m_deadline = m_now + qMax(1, timer->m_interval);
+        timer->m_order = m_nextOrder++;
+    }
+    m_fired++;
+    emit timer->timeout();
+}
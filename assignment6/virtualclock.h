@@ -0,0 +1,82 @@
+/**
+ * The entry point of the cat application.
+ *
+ * LAN QUANG HUYNH and Cheuk Yin Lau
+ * 2025-2-27
+ *
+ * virtualclock.h
+ *
+ * This file declares the VirtualClock, a Clock whose time only moves when
+ * advance() or advanceToNextTimer() is called. Timers created by it fire
+ * synchronously, in deadline order, from inside those calls, so no event
+ * loop is needed and a 500-round playback that takes hours on the wall
+ * clock replays in milliseconds. Counting the timeouts it delivers lets a
+ * benchmark measure scheduling overhead apart from the intended delays.
+ *
+ * Usage:
+ *  - VirtualClock clock; FrameDriver frames(&clock);
+ *  - Step with advance(ms) or jump from timer to timer with advanceToNextTimer().
+ */
+
+#ifndef VIRTUALCLOCK_H
+#define VIRTUALCLOCK_H
+
+#include <QVector>
+#include "gameclock.h"
+
+class VirtualTimer;
+
+class VirtualClock : public Clock {
+    Q_OBJECT
+public:
+    /**
+     * @brief Constructs a clock standing at time zero.
+     * @param parent Optional parent QObject.
+     */
+    explicit VirtualClock(QObject *parent = nullptr);
+
+    qint64 nowMs() const override { return m_now; }
+    GameTimer *createTimer(QObject *parent) override;
+
+    /**
+     * @brief Moves time forward, firing every timer that falls due on the way.
+     *
+     * Timers fire in deadline order with the clock set to their deadline,
+     * including timers started or restarted by earlier timeouts. A repeating
+     * timer with a zero interval fires once per virtual millisecond.
+     *
+     * @param ms How far to move, in milliseconds.
+     */
+    void advance(qint64 ms);
+
+    /**
+     * @brief Jumps to the earliest deadline and fires that timer.
+     * @return False if no timer is active; time does not move then.
+     */
+    bool advanceToNextTimer();
+
+    /**
+     * @brief Returns the number of timeouts delivered so far.
+     */
+    qint64 firedTimers() const { return m_fired; }
+
+private:
+    friend class VirtualTimer;
+
+    /**
+     * @brief Returns the active timer that falls due first, no later than limit.
+     */
+    VirtualTimer *nextDue(qint64 limit) const;
+
+    /**
+     * @brief Sets the clock to a timer's deadline, re-arms or stops it and emits its timeout.
+     */
+    void fire(VirtualTimer *timer);
+
+    qint64 m_now;                    ///< Current virtual time in milliseconds.
+    qint64 m_fired;                  ///< Timeouts delivered so far.
+    quint64 m_nextOrder;             ///< Start order handed out to timers, to break deadline ties.
+    QVector<VirtualTimer*> m_timers; ///< Every live timer created by this clock.
+};
+
+#endif // VIRTUALCLOCK_H